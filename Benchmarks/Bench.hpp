@@ -0,0 +1,128 @@
+/******************************************************************************/
+/* Bench.hpp                                                                  */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace SF::Bench
+{
+    /**
+     * @brief A benchmark body. Runs the measured operation `iterations` times.
+     */
+    using BenchmarkFunc = void (*)(uint64_t iterations);
+
+    /**
+     * @brief A registered benchmark, grouped by the subsystem it measures.
+     */
+    struct Benchmark
+    {
+        std::string_view group;
+        std::string_view name;
+        BenchmarkFunc func;
+    };
+
+    /**
+     * @brief Timing summary of one benchmark, all times are nanoseconds per iteration.
+     */
+    struct Result
+    {
+        std::string group;
+        std::string name;
+        uint64_t iterations = 0;
+        uint32_t samples = 0;
+        double minNs = 0.0;
+        double medianNs = 0.0;
+        double meanNs = 0.0;
+        double maxNs = 0.0;
+        double stddevNs = 0.0;
+    };
+
+    /**
+     * @brief All benchmarks registered through SF_BENCHMARK, in registration order.
+     */
+    inline std::vector<Benchmark> &Registry()
+    {
+        static std::vector<Benchmark> impl;
+        return impl;
+    }
+
+    struct Registrar
+    {
+        Registrar(std::string_view group, std::string_view name, BenchmarkFunc func)
+        {
+            Registry().push_back({group, name, func});
+        }
+    };
+
+    /**
+     * @brief Keeps the compiler from discarding a value that is otherwise unused.
+     */
+    template <typename T>
+    inline void DoNotOptimize(const T &value)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        static volatile const void *sink;
+        sink = &value;
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    /**
+     * @brief Forces pending stores to memory to be treated as observed.
+     */
+    inline void ClobberMemory()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : : "memory");
+#endif
+    }
+}
+
+// Defines and registers a benchmark body; `iterations` is in scope inside the body.
+// Setup that should not be timed goes in function-local statics, the warmup run pays for it.
+#define SF_BENCHMARK(group, name)                                                   \
+    static void SF_Bench_##group##_##name(uint64_t iterations);                     \
+    static const ::SF::Bench::Registrar SF_BenchRegistrar_##group##_##name(         \
+        #group, #name, &SF_Bench_##group##_##name);                                 \
+    static void SF_Bench_##group##_##name(uint64_t iterations)
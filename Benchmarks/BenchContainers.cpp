@@ -0,0 +1,139 @@
+/******************************************************************************/
+/* BenchContainers.cpp                                                        */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Bench.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <TemplateLibrary/Dynamic.hpp>
+
+// SFTL::DynamicArray against std::vector on the same workloads
+namespace
+{
+    constexpr size_t ElementCount = 4096;
+
+    template <typename Array>
+    const Array &FilledArray()
+    {
+        static const Array array = []
+        {
+            Array filled;
+            for (size_t i = 0; i < ElementCount; ++i)
+                filled.push_back(static_cast<int>((i * 2654435761u) % 1000));
+            return filled;
+        }();
+        return array;
+    }
+}
+
+SF_BENCHMARK(Containers, DynamicArray_PushBack)
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SFTL::DynamicArray<int> array;
+        for (size_t j = 0; j < ElementCount; ++j)
+            array.push_back(static_cast<int>(j));
+        SF::Bench::DoNotOptimize(array.data());
+    }
+}
+
+SF_BENCHMARK(Containers, StdVector_PushBack)
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        std::vector<int> vector;
+        for (size_t j = 0; j < ElementCount; ++j)
+            vector.push_back(static_cast<int>(j));
+        SF::Bench::DoNotOptimize(vector.data());
+    }
+}
+
+SF_BENCHMARK(Containers, DynamicArray_Iterate)
+{
+    const auto &array = FilledArray<SFTL::DynamicArray<int>>();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        long long sum = 0;
+        for (int value : array)
+            sum += value;
+        SF::Bench::DoNotOptimize(sum);
+    }
+}
+
+SF_BENCHMARK(Containers, StdVector_Iterate)
+{
+    const auto &vector = FilledArray<std::vector<int>>();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        long long sum = 0;
+        for (int value : vector)
+            sum += value;
+        SF::Bench::DoNotOptimize(sum);
+    }
+}
+
+SF_BENCHMARK(Containers, DynamicArray_FindMiss)
+{
+    const auto &array = FilledArray<SFTL::DynamicArray<int>>();
+    for (uint64_t i = 0; i < iterations; ++i)
+        SF::Bench::DoNotOptimize(array.find(-1));
+}
+
+SF_BENCHMARK(Containers, StdVector_FindMiss)
+{
+    const auto &vector = FilledArray<std::vector<int>>();
+    for (uint64_t i = 0; i < iterations; ++i)
+        SF::Bench::DoNotOptimize(std::find(vector.begin(), vector.end(), -1));
+}
+
+SF_BENCHMARK(Containers, DynamicArray_Copy)
+{
+    const auto &array = FilledArray<SFTL::DynamicArray<int>>();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SFTL::DynamicArray<int> copy(array);
+        SF::Bench::DoNotOptimize(copy.data());
+    }
+}
+
+SF_BENCHMARK(Containers, StdVector_Copy)
+{
+    const auto &vector = FilledArray<std::vector<int>>();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        std::vector<int> copy(vector);
+        SF::Bench::DoNotOptimize(copy.data());
+    }
+}
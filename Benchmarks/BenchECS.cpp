@@ -0,0 +1,264 @@
+/******************************************************************************/
+/* BenchECS.cpp                                                               */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Bench.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <ECS/Query.hpp>
+#include <ECS/Scheduler.hpp>
+#include <ECS/World.hpp>
+#include <UtilityClasses/ThreadPool.hpp>
+
+// Position += Velocity over an archetype ECS world against the same data as individually
+// heap allocated objects behind pointers, plus batch creation and destruction, system
+// scheduling and change filtered queries
+namespace
+{
+    struct Position
+    {
+        float x, y, z;
+    };
+
+    struct Velocity
+    {
+        float x, y, z;
+    };
+
+    struct Health
+    {
+        int32_t value;
+    };
+
+    constexpr size_t EntityCount = 200000;
+
+    struct GameObject
+    {
+        virtual ~GameObject() = default;
+
+        Position position{};
+        Velocity velocity{1.0f, 2.0f, 3.0f};
+        Health health{100};
+        char padding[64]{};
+    };
+
+    SF::Engine::ECS::World &IterationWorld()
+    {
+        static SF::Engine::ECS::World world;
+        if (world.GetEntityCount() == 0)
+            world.CreateBatch(EntityCount, Position{}, Velocity{1.0f, 2.0f, 3.0f}, Health{100});
+        return world;
+    }
+
+    std::vector<std::unique_ptr<GameObject>> &IterationObjects()
+    {
+        static std::vector<std::unique_ptr<GameObject>> objects = []
+        {
+            std::vector<std::unique_ptr<GameObject>> result;
+            result.reserve(EntityCount);
+            for (size_t i = 0; i < EntityCount; ++i)
+                result.push_back(std::make_unique<GameObject>());
+            return result;
+        }();
+        return objects;
+    }
+}
+
+SF_BENCHMARK(ECS, IteratePointerObjects)
+{
+    auto &objects = IterationObjects();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        for (const auto &object : objects)
+        {
+            object->position.x += object->velocity.x;
+            object->position.y += object->velocity.y;
+            object->position.z += object->velocity.z;
+        }
+        SF::Bench::DoNotOptimize(objects.front()->position);
+    }
+}
+
+SF_BENCHMARK(ECS, IterateEach)
+{
+    auto &world = IterationWorld();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        world.Each<Position, const Velocity>([](Position &position, const Velocity &velocity)
+                                             {
+                                                 position.x += velocity.x;
+                                                 position.y += velocity.y;
+                                                 position.z += velocity.z; });
+        SF::Bench::DoNotOptimize(world);
+    }
+}
+
+SF_BENCHMARK(ECS, IterateChunks)
+{
+    auto &world = IterationWorld();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        world.ForEachChunk<Position, const Velocity>([](const SF::Engine::ECS::Entity *, size_t count, Position *positions, const Velocity *velocities)
+                                                     {
+                                                         for (size_t row = 0; row < count; ++row)
+                                                         {
+                                                             positions[row].x += velocities[row].x;
+                                                             positions[row].y += velocities[row].y;
+                                                             positions[row].z += velocities[row].z;
+                                                         } });
+        SF::Bench::DoNotOptimize(world);
+    }
+}
+
+SF_BENCHMARK(ECS, CreateDestroyIndividually)
+{
+    SF::Engine::ECS::World world;
+    std::vector<SF::Engine::ECS::Entity> entities(10000);
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        for (auto &entity : entities)
+            entity = world.Create(Position{}, Velocity{}, Health{100});
+        for (const auto &entity : entities)
+            world.Destroy(entity);
+        SF::Bench::DoNotOptimize(entities);
+    }
+}
+
+SF_BENCHMARK(ECS, CreateDestroyBatch)
+{
+    SF::Engine::ECS::World world;
+    std::vector<SF::Engine::ECS::Entity> entities(10000);
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        world.CreateBatch<Position, Velocity, Health>(entities, Position{}, Velocity{}, Health{100});
+        world.DestroyBatch(entities);
+        SF::Bench::DoNotOptimize(entities);
+    }
+}
+
+SF_BENCHMARK(ECS, AddRemoveComponent)
+{
+    SF::Engine::ECS::World world;
+    const auto entities = world.CreateBatch(10000, Position{}, Velocity{});
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        for (const auto &entity : entities)
+            world.Add(entity, Health{1});
+        for (const auto &entity : entities)
+            world.Remove<Health>(entity);
+        SF::Bench::DoNotOptimize(world);
+    }
+}
+
+SF_BENCHMARK(ECS, SchedulerSerial)
+{
+    auto &world = IterationWorld();
+    SF::Engine::ECS::Scheduler scheduler;
+    scheduler.Add<Position, const Velocity>("Move", [](const SF::Engine::ECS::Entity *, size_t count, Position *positions, const Velocity *velocities)
+                                            {
+                                                for (size_t row = 0; row < count; ++row)
+                                                    positions[row].x += velocities[row].x; });
+    scheduler.Add<Health>("Regenerate", [](const SF::Engine::ECS::Entity *, size_t count, Health *healths)
+                          {
+                              for (size_t row = 0; row < count; ++row)
+                                  ++healths[row].value; });
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        scheduler.Run(world);
+        SF::Bench::DoNotOptimize(world);
+    }
+}
+
+SF_BENCHMARK(ECS, SchedulerParallel)
+{
+    auto &world = IterationWorld();
+    static SF::Engine::ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    SF::Engine::ECS::Scheduler scheduler;
+    scheduler.Add<Position, const Velocity>("Move", [](const SF::Engine::ECS::Entity *, size_t count, Position *positions, const Velocity *velocities)
+                                            {
+                                                for (size_t row = 0; row < count; ++row)
+                                                    positions[row].x += velocities[row].x; });
+    scheduler.Add<Health>("Regenerate", [](const SF::Engine::ECS::Entity *, size_t count, Health *healths)
+                          {
+                              for (size_t row = 0; row < count; ++row)
+                                  ++healths[row].value; });
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        scheduler.Run(world, &pool);
+        SF::Bench::DoNotOptimize(world);
+    }
+}
+
+SF_BENCHMARK(ECS, QueryEach)
+{
+    auto &world = IterationWorld();
+    SF::Engine::ECS::Query<Position, const Velocity> query(world);
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        query.Each([](Position &position, const Velocity &velocity)
+                   {
+                       position.x += velocity.x;
+                       position.y += velocity.y;
+                       position.z += velocity.z; });
+        SF::Bench::DoNotOptimize(world);
+    }
+}
+
+// One entity in a hundred changes per frame, a run of neighbours as when a group of units
+// moves, so the filtered query skips the untouched chunks
+SF_BENCHMARK(ECS, QueryChangedFew)
+{
+    SF::Engine::ECS::World world;
+    const auto entities = world.CreateBatch(EntityCount, Position{}, Health{100});
+    SF::Engine::ECS::Query<const Position, Health> query(world);
+    query.SetChangeFilter<Position>();
+    query.Each([](const Position &, Health &) {});
+
+    size_t first = 0;
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        first = (first + EntityCount / 100) % EntityCount;
+        for (size_t changed = 0; changed < EntityCount / 100; ++changed)
+        {
+            const SF::Engine::ECS::Entity entity = entities[(first + changed) % EntityCount];
+            world.Get<Position>(entity)->x += 1.0f;
+            world.MarkChanged<Position>(entity);
+        }
+
+        query.Each([](const Position &position, Health &health)
+                   { health.value = static_cast<int32_t>(position.x); });
+        SF::Bench::DoNotOptimize(world);
+    }
+}
@@ -0,0 +1,146 @@
+/******************************************************************************/
+/* BenchFormat.cpp                                                            */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Bench.hpp"
+
+#include <cstdio>
+#include <string>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+#include <TemplateLibrary/Charconv.hpp>
+#include <TemplateLibrary/Format.hpp>
+
+// SFTL::Format against snprintf and std::format producing the same text
+SF_BENCHMARK(Format, SFTL_Format)
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        std::string text = SFTL::Format("Entity {} at ({:f}, {:f}) named {}", static_cast<int>(i), 1.5, -2.25, "Player");
+        SF::Bench::DoNotOptimize(text.data());
+    }
+}
+
+SF_BENCHMARK(Format, SFTL_FormatTo)
+{
+    char buffer[128];
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SFTL::FormatTo(buffer, sizeof(buffer), "Entity {} at ({:f}, {:f}) named {}", static_cast<int>(i), 1.5, -2.25, "Player");
+        SF::Bench::DoNotOptimize(buffer);
+    }
+}
+
+SF_BENCHMARK(Format, SFTL_FormatPrintf)
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        std::string text = SFTL::FormatPrintf("Entity %d at (%f, %f) named %s", static_cast<int>(i), 1.5, -2.25, "Player");
+        SF::Bench::DoNotOptimize(text.data());
+    }
+}
+
+SF_BENCHMARK(Format, Snprintf)
+{
+    char buffer[128];
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        std::snprintf(buffer, sizeof(buffer), "Entity %d at (%f, %f) named %s", static_cast<int>(i), 1.5, -2.25, "Player");
+        SF::Bench::DoNotOptimize(buffer);
+    }
+}
+
+#if defined(__cpp_lib_format)
+SF_BENCHMARK(Format, StdFormat)
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        std::string text = std::format("Entity {} at ({:f}, {:f}) named {}", static_cast<int>(i), 1.5, -2.25, "Player");
+        SF::Bench::DoNotOptimize(text.data());
+    }
+}
+#endif
+
+SF_BENCHMARK(Format, StringBuilder_Append)
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SFTL::StringBuilder builder;
+        builder << "Entity " << static_cast<int>(i) << " named " << "Player";
+        std::string text = builder.ToString();
+        SF::Bench::DoNotOptimize(text.data());
+    }
+}
+
+// Number to text, one conversion per iteration over a spread of magnitudes
+SF_BENCHMARK(Format, Integer_SFTL_ToChars)
+{
+    char buffer[32];
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SFTL::ToChars(buffer, buffer + sizeof(buffer), static_cast<int64_t>(i * 2654435761u) >> (i & 31));
+        SF::Bench::DoNotOptimize(buffer);
+    }
+}
+
+SF_BENCHMARK(Format, Integer_StdToChars)
+{
+    char buffer[32];
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        std::to_chars(buffer, buffer + sizeof(buffer), static_cast<int64_t>(i * 2654435761u) >> (i & 31));
+        SF::Bench::DoNotOptimize(buffer);
+    }
+}
+
+SF_BENCHMARK(Format, Double_SFTL_Shortest)
+{
+    char buffer[32];
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SFTL::ToChars(buffer, buffer + sizeof(buffer), static_cast<double>(i) * 0.1);
+        SF::Bench::DoNotOptimize(buffer);
+    }
+}
+
+SF_BENCHMARK(Format, Double_Snprintf17g)
+{
+    char buffer[32];
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        std::snprintf(buffer, sizeof(buffer), "%.17g", static_cast<double>(i) * 0.1);
+        SF::Bench::DoNotOptimize(buffer);
+    }
+}
@@ -0,0 +1,74 @@
+/******************************************************************************/
+/* BenchLog.cpp                                                               */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Bench.hpp"
+
+#include <spdlog/sinks/null_sink.h>
+
+#include <Engine/Log/Log.hpp>
+
+// Cost of a Log call, with the sinks swapped for a null sink so no I/O is measured
+namespace
+{
+    void UseNullSink()
+    {
+        static const bool installed = []
+        {
+            auto &logger = SF::Engine::Log::GetLogger();
+            logger->sinks().clear();
+            logger->sinks().push_back(std::make_shared<spdlog::sinks::null_sink_mt>());
+            logger->flush_on(spdlog::level::off);
+            return true;
+        }();
+        (void)installed;
+    }
+}
+
+SF_BENCHMARK(Log, Info_Enabled)
+{
+    UseNullSink();
+    SF::Engine::Log::SetLevel(spdlog::level::info);
+    SF::Engine::Log::GetLogger()->flush_on(spdlog::level::off);
+
+    for (uint64_t i = 0; i < iterations; ++i)
+        SF::Engine::Log::Info("Frame {} took {} ms", i, 16.6);
+}
+
+SF_BENCHMARK(Log, Debug_Filtered)
+{
+    UseNullSink();
+    SF::Engine::Log::SetLevel(spdlog::level::info);
+
+    for (uint64_t i = 0; i < iterations; ++i)
+        SF::Engine::Log::Debug("Frame {} took {} ms", i, 16.6);
+}
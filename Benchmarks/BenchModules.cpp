@@ -0,0 +1,109 @@
+/******************************************************************************/
+/* BenchModules.cpp                                                           */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Bench.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <Engine/StaticModules.hpp>
+
+// One stage of small modules updated the engine's way, through Module::Update, against the
+// generated direct calls of a StaticModuleList
+namespace
+{
+    using SF::Engine::Module;
+
+    template <int N>
+    class BenchModule final : public Module::Registrar<BenchModule<N>>
+    {
+    public:
+        void Update() override { value = value * 3 + N; }
+
+        Module::Stage GetStage() const override { return Module::Stage::Normal; }
+        SF::Engine::TypeId GetTypeId() const override { return SF::Engine::TypeInfo<Module>::GetTypeId<BenchModule<N>>(); }
+        std::string_view GetName() const override { return "BenchModule"; }
+
+        uint64_t value = 0;
+    };
+
+    constexpr int ModuleCount = 32;
+
+    template <int... N>
+    auto MakeStage(std::integer_sequence<int, N...>) -> SF::Engine::StaticStage<Module::Stage::Normal, BenchModule<N>...>;
+
+    template <int... N>
+    void RegisterAll(std::integer_sequence<int, N...>)
+    {
+        (Module::RegisterModule<BenchModule<N>>(Module::Stage::Normal), ...);
+    }
+
+    using BenchStage = decltype(MakeStage(std::make_integer_sequence<int, ModuleCount>{}));
+
+    // Creates the instances through the registry like the engine does
+    const std::vector<std::unique_ptr<Module>> &Modules()
+    {
+        static const std::vector<std::unique_ptr<Module>> modules = []
+        {
+            RegisterAll(std::make_integer_sequence<int, ModuleCount>{});
+
+            std::vector<std::unique_ptr<Module>> created;
+            for (auto id : BenchStage::GetIds())
+                created.push_back(Module::Registry().at(id).createFunc());
+            return created;
+        }();
+        return modules;
+    }
+}
+
+SF_BENCHMARK(Modules, VirtualUpdate)
+{
+    const auto &modules = Modules();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        for (const auto &module : modules)
+            module->Update();
+        SF::Bench::DoNotOptimize(modules.front().get());
+    }
+}
+
+SF_BENCHMARK(Modules, StaticUpdate)
+{
+    const auto &modules = Modules();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        BenchStage::Update();
+        SF::Bench::DoNotOptimize(modules.front().get());
+    }
+}
@@ -0,0 +1,144 @@
+/******************************************************************************/
+/* BenchParse.cpp                                                             */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Bench.hpp"
+
+#include <charconv>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+#include <UtilityClasses/NumberParse.hpp>
+
+// Text to number: SF::Engine::parse_number against std::from_chars and strtod on
+// the kind of data found in config files and text meshes
+namespace
+{
+    constexpr size_t ValueCount = 4096;
+
+    const std::string &FloatText()
+    {
+        static const std::string text = []
+        {
+            std::mt19937 rng(7);
+            std::uniform_real_distribution<float> dist(-1000.0f, 1000.0f);
+            std::string generated;
+            char buffer[32];
+            for (size_t i = 0; i < ValueCount; ++i)
+            {
+                const int length = std::snprintf(buffer, sizeof(buffer), "%.6f ", dist(rng));
+                generated.append(buffer, static_cast<size_t>(length));
+            }
+            return generated;
+        }();
+        return text;
+    }
+
+    const std::string &IntegerText()
+    {
+        static const std::string text = []
+        {
+            std::mt19937_64 rng(7);
+            std::string generated;
+            for (size_t i = 0; i < ValueCount; ++i)
+            {
+                generated += std::to_string(static_cast<int64_t>(rng() >> (rng() % 64)));
+                generated += ' ';
+            }
+            return generated;
+        }();
+        return text;
+    }
+
+    template <typename T, typename Parse>
+    void ParseAll(const std::string &text, uint64_t iterations, Parse parse)
+    {
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            const char *p = text.data();
+            const char *last = text.data() + text.size();
+            T sum{};
+            while (p < last)
+            {
+                T value{};
+                p = parse(p, last, value) + 1;
+                sum += value;
+            }
+            SF::Bench::DoNotOptimize(sum);
+        }
+    }
+}
+
+SF_BENCHMARK(Parse, Float_ParseNumber)
+{
+    ParseAll<float>(FloatText(), iterations, [](const char *p, const char *last, float &value)
+                    { return SF::Engine::parse_number(p, last, value).ptr; });
+}
+
+SF_BENCHMARK(Parse, Float_StdFromChars)
+{
+    ParseAll<float>(FloatText(), iterations, [](const char *p, const char *last, float &value)
+                    { return std::from_chars(p, last, value).ptr; });
+}
+
+SF_BENCHMARK(Parse, Float_Strtof)
+{
+    ParseAll<float>(FloatText(), iterations, [](const char *p, const char *, float &value)
+                    {
+                        char *end;
+                        value = std::strtof(p, &end);
+                        return static_cast<const char *>(end); });
+}
+
+SF_BENCHMARK(Parse, Float_Batch)
+{
+    SFTL::DynamicArray<float> values;
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        values.clear();
+        SF::Engine::parse_floats(FloatText(), values);
+        SF::Bench::DoNotOptimize(values.data());
+    }
+}
+
+SF_BENCHMARK(Parse, Integer_ParseNumber)
+{
+    ParseAll<int64_t>(IntegerText(), iterations, [](const char *p, const char *last, int64_t &value)
+                      { return SF::Engine::parse_number(p, last, value).ptr; });
+}
+
+SF_BENCHMARK(Parse, Integer_StdFromChars)
+{
+    ParseAll<int64_t>(IntegerText(), iterations, [](const char *p, const char *last, int64_t &value)
+                      { return std::from_chars(p, last, value).ptr; });
+}
@@ -0,0 +1,112 @@
+/******************************************************************************/
+/* BenchResources.cpp                                                         */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Bench.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Resources/Resources.hpp>
+
+// Resources::Find by name for a hit and for a name that was never added, and by a name
+// interned up front
+namespace
+{
+    class BenchResource : public SF::Engine::Resource
+    {
+    public:
+        SF::Engine::TypeId GetTypeId() const override { return SF::Engine::TypeInfo<SF::Engine::Resource>::GetTypeId<BenchResource>(); }
+    };
+
+    // Resources leaves the Module identity to the engine, fill it in so it can stand alone
+    class BenchResources final : public SF::Engine::Resources
+    {
+    public:
+        Stage GetStage() const override { return Stage::Post; }
+        SF::Engine::TypeId GetTypeId() const override { return 0; }
+        std::string_view GetName() const override { return "BenchResources"; }
+    };
+
+    constexpr size_t ResourceCount = 256;
+
+    struct Fixture
+    {
+        BenchResources resources;
+        std::vector<std::shared_ptr<SF::Engine::Resource>> held;
+        std::vector<std::string> names;
+        std::vector<SFTL::InternedString> internedNames;
+
+        Fixture()
+        {
+            for (size_t i = 0; i < ResourceCount; ++i)
+            {
+                names.push_back("Textures/Bench" + std::to_string(i) + ".png");
+                held.push_back(std::make_shared<BenchResource>());
+                resources.Add(held.back(), names.back().data());
+                internedNames.emplace_back(names.back());
+            }
+        }
+    };
+
+    Fixture &GetFixture()
+    {
+        static Fixture fixture;
+        return fixture;
+    }
+}
+
+SF_BENCHMARK(Resources, Find_Hit)
+{
+    auto &fixture = GetFixture();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        auto &name = fixture.names[i % ResourceCount];
+        SF::Bench::DoNotOptimize(fixture.resources.Find<BenchResource>(name.data()));
+    }
+}
+
+SF_BENCHMARK(Resources, Find_HitInterned)
+{
+    auto &fixture = GetFixture();
+    for (uint64_t i = 0; i < iterations; ++i)
+        SF::Bench::DoNotOptimize(fixture.resources.Find<BenchResource>(fixture.internedNames[i % ResourceCount]));
+}
+
+SF_BENCHMARK(Resources, Find_Miss)
+{
+    auto &fixture = GetFixture();
+    std::string missing = "Textures/Missing.png";
+    for (uint64_t i = 0; i < iterations; ++i)
+        SF::Bench::DoNotOptimize(fixture.resources.Find<BenchResource>(missing.data()));
+}
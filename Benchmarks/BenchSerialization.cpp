@@ -0,0 +1,160 @@
+/******************************************************************************/
+/* BenchSerialization.cpp                                                     */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Bench.hpp"
+
+#include <string>
+#include <vector>
+
+#include <Reflection/Macros.hpp>
+#include <Reflection/Serialization.hpp>
+
+// Level-sized images: Serialize, the bulk-copy Deserialize and reading in place with Read
+namespace
+{
+    struct Transform
+    {
+        float position[3];
+        float rotation[4];
+        float scale[3];
+        uint32_t parent;
+
+        ExportClass(Transform, ExportField(position), ExportField(rotation), ExportField(scale), ExportField(parent))
+    };
+
+    struct Prop
+    {
+        std::string mesh;
+        uint32_t transform;
+        bool visible;
+
+        ExportClass(Prop, ExportField(mesh), ExportField(transform), ExportField(visible))
+    };
+
+    struct Level
+    {
+        std::string name;
+        std::vector<Transform> transforms;
+        std::vector<Prop> props;
+
+        ExportClass(Level, ExportField(name), ExportField(transforms), ExportField(props))
+    };
+
+    constexpr size_t TransformCount = 100000;
+    constexpr size_t PropCount = 10000;
+
+    const Level &SampleLevel()
+    {
+        static const Level level = []
+        {
+            Level generated;
+            generated.name = "Bench";
+            generated.transforms.resize(TransformCount);
+            for (size_t i = 0; i < TransformCount; ++i)
+                generated.transforms[i] = {{float(i), 0.0f, 1.0f}, {0.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f}, uint32_t(i / 2)};
+            for (size_t i = 0; i < PropCount; ++i)
+                generated.props.push_back({"Meshes/Prop" + std::to_string(i % 64), uint32_t(i), (i % 3) != 0});
+            return generated;
+        }();
+        return level;
+    }
+
+    const SFTL::DynamicArray<std::byte> &SampleImage()
+    {
+        static const SFTL::DynamicArray<std::byte> image = SF::Engine::Reflection::Serialize(SampleLevel());
+        return image;
+    }
+}
+
+SF_BENCHMARK(Serialization, Serialize)
+{
+    SFTL::DynamicArray<std::byte> image;
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SF::Engine::Reflection::Serialize(SampleLevel(), image);
+        SF::Bench::DoNotOptimize(image.data());
+    }
+}
+
+SF_BENCHMARK(Serialization, Deserialize)
+{
+    const auto &image = SampleImage();
+    Level level;
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SF::Engine::Reflection::Deserialize(std::span<const std::byte>(image.data(), image.size()), level);
+        SF::Bench::DoNotOptimize(level.transforms.data());
+    }
+}
+
+SF_BENCHMARK(Serialization, Read_Validated)
+{
+    const auto &image = SampleImage();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        auto view = SF::Engine::Reflection::Read<Level>(std::span<const std::byte>(image.data(), image.size()));
+        SF::Bench::DoNotOptimize(view->Get<"transforms">()[TransformCount - 1].parent);
+    }
+}
+
+SF_BENCHMARK(Serialization, ReadUnchecked)
+{
+    const auto &image = SampleImage();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        auto view = SF::Engine::Reflection::ReadUnchecked<Level>(std::span<const std::byte>(image.data(), image.size()));
+        SF::Bench::DoNotOptimize(view->Get<"transforms">()[TransformCount - 1].parent);
+    }
+}
+
+// Object-by-object load, what the engine did before: every element copied field by field
+SF_BENCHMARK(Serialization, Baseline_PerObjectCopy)
+{
+    const Level &source = SampleLevel();
+    Level level;
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        level.transforms.clear();
+        level.props.clear();
+        level.name = source.name;
+        for (const Transform &transform : source.transforms)
+        {
+            Transform &copy = level.transforms.emplace_back();
+            SF::Engine::Reflection::ForEachField(transform, [&](const auto &field, const auto &value)
+                                                 { std::memcpy(&field.Get(copy), &value, sizeof(value)); });
+        }
+        for (const Prop &prop : source.props)
+            level.props.push_back({prop.mesh, prop.transform, prop.visible});
+        SF::Bench::DoNotOptimize(level.transforms.data());
+    }
+}
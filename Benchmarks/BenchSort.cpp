@@ -0,0 +1,113 @@
+/******************************************************************************/
+/* BenchSort.cpp                                                              */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Bench.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <TemplateLibrary/Sort.hpp>
+
+// SFTL::Sort and SFTL::RadixSort against std::sort on render-queue sized key sets
+namespace
+{
+    constexpr size_t KeyCount = 1 << 20;
+
+    const std::vector<uint64_t> &Keys()
+    {
+        static const std::vector<uint64_t> keys = []
+        {
+            std::mt19937_64 rng(42);
+            std::vector<uint64_t> generated(KeyCount);
+            for (auto &key : generated)
+                key = rng();
+            return generated;
+        }();
+        return keys;
+    }
+
+    SF::Engine::ThreadPool &Pool()
+    {
+        static SF::Engine::ThreadPool pool;
+        return pool;
+    }
+}
+
+SF_BENCHMARK(Sort, StdSort)
+{
+    std::vector<uint64_t> keys;
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        keys = Keys();
+        std::sort(keys.begin(), keys.end());
+        SF::Bench::DoNotOptimize(keys.data());
+    }
+}
+
+SF_BENCHMARK(Sort, Sort_Parallel)
+{
+    std::vector<uint64_t> keys;
+    SFTL::SortOptions options;
+    options.pool = &Pool();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        keys = Keys();
+        SFTL::Sort(std::span<uint64_t>(keys), std::less<>{}, options);
+        SF::Bench::DoNotOptimize(keys.data());
+    }
+}
+
+SF_BENCHMARK(Sort, RadixSort)
+{
+    std::vector<uint64_t> keys;
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        keys = Keys();
+        SFTL::RadixSort(std::span<uint64_t>(keys));
+        SF::Bench::DoNotOptimize(keys.data());
+    }
+}
+
+SF_BENCHMARK(Sort, RadixSort_Parallel)
+{
+    std::vector<uint64_t> keys;
+    SFTL::SortOptions options;
+    options.pool = &Pool();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        keys = Keys();
+        SFTL::RadixSort(std::span<uint64_t>(keys), options);
+        SF::Bench::DoNotOptimize(keys.data());
+    }
+}
@@ -0,0 +1,151 @@
+/******************************************************************************/
+/* BenchString.cpp                                                            */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Bench.hpp"
+
+#include <cstring>
+#include <string>
+
+#include <UtilityClasses/Char.hpp>
+
+// Char.hpp string routines at runtime (vectorized) against the C library
+namespace
+{
+    const std::string &LongText()
+    {
+        static const std::string text = []
+        {
+            std::string generated;
+            while (generated.size() < 4096)
+                generated += "The quick brown fox jumps over the lazy dog. ";
+            generated += "needle";
+            return generated;
+        }();
+        return text;
+    }
+
+    const std::string &LongTextUpper()
+    {
+        static const std::string text = []
+        {
+            std::string generated = LongText();
+            for (char &c : generated)
+                c = SF::Engine::to_upper(c);
+            return generated;
+        }();
+        return text;
+    }
+}
+
+SF_BENCHMARK(String, Strlen_Engine)
+{
+    const char *text = LongText().c_str();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SF::Bench::DoNotOptimize(text);
+        SF::Bench::DoNotOptimize(SF::Engine::strlen(text));
+    }
+}
+
+SF_BENCHMARK(String, Strlen_Libc)
+{
+    const char *text = LongText().c_str();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SF::Bench::DoNotOptimize(text);
+        SF::Bench::DoNotOptimize(std::strlen(text));
+    }
+}
+
+SF_BENCHMARK(String, Strcmp_Engine)
+{
+    const std::string copy = LongText();
+    const char *text = LongText().c_str();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SF::Bench::DoNotOptimize(text);
+        SF::Bench::DoNotOptimize(SF::Engine::strcmp(text, copy.c_str()));
+    }
+}
+
+SF_BENCHMARK(String, Strcmp_Libc)
+{
+    const std::string copy = LongText();
+    const char *text = LongText().c_str();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SF::Bench::DoNotOptimize(text);
+        SF::Bench::DoNotOptimize(std::strcmp(text, copy.c_str()));
+    }
+}
+
+SF_BENCHMARK(String, Stricmp_Engine)
+{
+    const char *text = LongText().c_str();
+    const char *upper = LongTextUpper().c_str();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SF::Bench::DoNotOptimize(text);
+        SF::Bench::DoNotOptimize(SF::Engine::stricmp(text, upper));
+    }
+}
+
+SF_BENCHMARK(String, Strstr_Engine)
+{
+    const char *text = LongText().c_str();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SF::Bench::DoNotOptimize(text);
+        SF::Bench::DoNotOptimize(SF::Engine::strstr(text, "needle"));
+    }
+}
+
+SF_BENCHMARK(String, Strstr_Libc)
+{
+    const char *text = LongText().c_str();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SF::Bench::DoNotOptimize(text);
+        SF::Bench::DoNotOptimize(std::strstr(text, "needle"));
+    }
+}
+
+SF_BENCHMARK(String, Memchr_Engine)
+{
+    const std::string &text = LongText();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SF::Bench::DoNotOptimize(text.data());
+        SF::Bench::DoNotOptimize(SF::Engine::memchr(text.data(), '!', text.size()));
+    }
+}
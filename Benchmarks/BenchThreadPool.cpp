@@ -0,0 +1,81 @@
+/******************************************************************************/
+/* BenchThreadPool.cpp                                                        */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Bench.hpp"
+
+#include <future>
+#include <vector>
+
+#include <UtilityClasses/ThreadPool.hpp>
+
+// ThreadPool::Enqueue measured as batch throughput and as single task round trip latency
+namespace
+{
+    SF::Engine::ThreadPool &Pool()
+    {
+        static SF::Engine::ThreadPool pool;
+        return pool;
+    }
+
+    constexpr size_t BatchSize = 256;
+}
+
+SF_BENCHMARK(ThreadPool, Enqueue_Throughput)
+{
+    auto &pool = Pool();
+    std::vector<std::future<int>> futures;
+    futures.reserve(BatchSize);
+
+    // One iteration enqueues a full batch, so divide median_ns by BatchSize for per-task cost
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        for (size_t j = 0; j < BatchSize; ++j)
+            futures.push_back(pool.Enqueue([j]
+                                           { return static_cast<int>(j); }));
+
+        for (auto &future : futures)
+            SF::Bench::DoNotOptimize(future.get());
+        futures.clear();
+    }
+}
+
+SF_BENCHMARK(ThreadPool, Enqueue_Latency)
+{
+    auto &pool = Pool();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        auto future = pool.Enqueue([]
+                                   { return 1; });
+        SF::Bench::DoNotOptimize(future.get());
+    }
+}
@@ -0,0 +1,100 @@
+/******************************************************************************/
+/* BenchTypeInformation.cpp                                                   */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Bench.hpp"
+
+#include <shared_mutex>
+#include <unordered_map>
+#if defined(__cpp_rtti) || defined(_CPPRTTI)
+#include <typeindex>
+#endif
+
+#include <UtilityClasses/TypeInformation.hpp>
+
+// TypeInformation::GetTypeId on an already registered type, the hot path of module lookups
+namespace
+{
+    struct BenchBase
+    {
+    };
+
+    template <int N>
+    struct BenchDerived : BenchBase
+    {
+    };
+
+    using BenchTypeInfo = SF::Engine::TypeInformation<BenchBase>;
+
+#if defined(__cpp_rtti) || defined(_CPPRTTI)
+    // The type_index map + shared_mutex lookup GetTypeId used before the per-type slots
+    template <typename K>
+    SF::Engine::TypeId MapLookup()
+    {
+        static std::shared_mutex mutex;
+        static std::unordered_map<std::type_index, SF::Engine::TypeId> map{{typeid(K), 0}};
+        std::shared_lock lock(mutex);
+        return map.find(std::type_index(typeid(K)))->second;
+    }
+#endif
+}
+
+SF_BENCHMARK(TypeInformation, GetTypeId)
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+        SF::Bench::DoNotOptimize(BenchTypeInfo::GetTypeId<BenchDerived<0>>());
+}
+
+SF_BENCHMARK(TypeInformation, GetTypeId_Mixed)
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        SF::Bench::DoNotOptimize(BenchTypeInfo::GetTypeId<BenchDerived<1>>());
+        SF::Bench::DoNotOptimize(BenchTypeInfo::GetTypeId<BenchDerived<2>>());
+        SF::Bench::DoNotOptimize(BenchTypeInfo::GetTypeId<BenchDerived<3>>());
+        SF::Bench::DoNotOptimize(BenchTypeInfo::GetTypeId<BenchDerived<4>>());
+    }
+}
+
+SF_BENCHMARK(TypeInformation, IsRegistered)
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+        SF::Bench::DoNotOptimize(BenchTypeInfo::IsRegistered<BenchDerived<0>>());
+}
+
+#if defined(__cpp_rtti) || defined(_CPPRTTI)
+SF_BENCHMARK(TypeInformation, Baseline_TypeIndexMap)
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+        SF::Bench::DoNotOptimize(MapLookup<BenchDerived<0>>());
+}
+#endif
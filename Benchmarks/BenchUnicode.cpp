@@ -0,0 +1,100 @@
+/******************************************************************************/
+/* BenchUnicode.cpp                                                           */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Bench.hpp"
+
+#include <string>
+
+#include <UtilityClasses/Unicode.hpp>
+
+// UTF-8 validation and transcoding on mostly-ASCII and on CJK-heavy localized text
+namespace
+{
+    const std::string &LatinText()
+    {
+        static const std::string text = []
+        {
+            std::string generated;
+            while (generated.size() < 64 * 1024)
+                generated += "Appuyez sur \xC3\x89" "chap pour reprendre la partie. Press Escape to resume the game. ";
+            return generated;
+        }();
+        return text;
+    }
+
+    const std::string &CjkText()
+    {
+        static const std::string text = []
+        {
+            std::string generated;
+            while (generated.size() < 64 * 1024)
+                generated += "\xE3\x82\xB2\xE3\x83\xBC\xE3\x83\xA0\xE3\x82\x92\xE5\x86\x8D\xE9\x96\x8B\xE3\x81\x99\xE3\x82\x8B ";
+            return generated;
+        }();
+        return text;
+    }
+}
+
+SF_BENCHMARK(Unicode, ValidateUtf8_Latin)
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+        SF::Bench::DoNotOptimize(SF::Engine::Unicode::ValidateUtf8(LatinText()));
+}
+
+SF_BENCHMARK(Unicode, ValidateUtf8_Cjk)
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+        SF::Bench::DoNotOptimize(SF::Engine::Unicode::ValidateUtf8(CjkText()));
+}
+
+SF_BENCHMARK(Unicode, Utf8ToUtf16_Latin)
+{
+    std::u16string out(LatinText().size(), u'\0');
+    for (uint64_t i = 0; i < iterations; ++i)
+        SF::Bench::DoNotOptimize(SF::Engine::Unicode::Utf8ToUtf16(LatinText().data(), LatinText().size(), out.data()));
+}
+
+SF_BENCHMARK(Unicode, Utf8ToUtf16_Cjk)
+{
+    std::u16string out(CjkText().size(), u'\0');
+    for (uint64_t i = 0; i < iterations; ++i)
+        SF::Bench::DoNotOptimize(SF::Engine::Unicode::Utf8ToUtf16(CjkText().data(), CjkText().size(), out.data()));
+}
+
+SF_BENCHMARK(Unicode, Utf16ToUtf8_Latin)
+{
+    const std::u16string text = *SF::Engine::Unicode::ToUtf16(LatinText());
+    std::string out(text.size() * 3, '\0');
+    for (uint64_t i = 0; i < iterations; ++i)
+        SF::Bench::DoNotOptimize(SF::Engine::Unicode::Utf16ToUtf8(text.data(), text.size(), out.data()));
+}
@@ -0,0 +1,274 @@
+/******************************************************************************/
+/* Main.cpp                                                                   */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Bench.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <Engine/Version.hpp>
+#include <TemplateLibrary/Simd.hpp>
+
+using namespace SF::Bench;
+
+namespace
+{
+    struct Options
+    {
+        std::string filter;
+        std::string outputPath;
+        uint32_t samples = 15;
+        double minSampleMs = 10.0;
+        bool list = false;
+    };
+
+    double TimeIterations(BenchmarkFunc func, uint64_t iterations)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func(iterations);
+        ClobberMemory();
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count();
+    }
+
+    // Grows the iteration count until one sample takes at least minSampleMs
+    uint64_t Calibrate(BenchmarkFunc func, double minSampleMs)
+    {
+        const double targetNs = minSampleMs * 1e6;
+        uint64_t iterations = 1;
+
+        while (true)
+        {
+            const double elapsed = TimeIterations(func, iterations);
+            if (elapsed >= targetNs || iterations >= (uint64_t(1) << 40))
+                return iterations;
+
+            // Aim slightly past the target, but never grow more than 10x at once
+            const double scale = elapsed > 0.0 ? std::min(10.0, 1.2 * targetNs / elapsed) : 10.0;
+            iterations = std::max(iterations + 1, static_cast<uint64_t>(static_cast<double>(iterations) * scale));
+        }
+    }
+
+    Result Run(const Benchmark &benchmark, const Options &options)
+    {
+        // The calibration runs double as warmup and pay for any lazy setup
+        const uint64_t iterations = Calibrate(benchmark.func, options.minSampleMs);
+
+        std::vector<double> perIteration;
+        perIteration.reserve(options.samples);
+        for (uint32_t i = 0; i < options.samples; ++i)
+            perIteration.push_back(TimeIterations(benchmark.func, iterations) / static_cast<double>(iterations));
+
+        std::sort(perIteration.begin(), perIteration.end());
+
+        Result result;
+        result.group = benchmark.group;
+        result.name = benchmark.name;
+        result.iterations = iterations;
+        result.samples = options.samples;
+        result.minNs = perIteration.front();
+        result.maxNs = perIteration.back();
+
+        const size_t middle = perIteration.size() / 2;
+        result.medianNs = perIteration.size() % 2 ? perIteration[middle]
+                                                  : 0.5 * (perIteration[middle - 1] + perIteration[middle]);
+
+        double sum = 0.0;
+        for (double value : perIteration)
+            sum += value;
+        result.meanNs = sum / static_cast<double>(perIteration.size());
+
+        double squares = 0.0;
+        for (double value : perIteration)
+            squares += (value - result.meanNs) * (value - result.meanNs);
+        result.stddevNs = std::sqrt(squares / static_cast<double>(perIteration.size()));
+
+        return result;
+    }
+
+    std::string JsonEscape(std::string_view text)
+    {
+        std::string escaped;
+        escaped.reserve(text.size());
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+                escaped += '\\';
+            escaped += c;
+        }
+        return escaped;
+    }
+
+    std::string CompilerName()
+    {
+        std::ostringstream oss;
+#if defined(__clang__)
+        oss << "clang " << __clang_major__ << "." << __clang_minor__ << "." << __clang_patchlevel__;
+#elif defined(__GNUC__)
+        oss << "gcc " << __GNUC__ << "." << __GNUC_MINOR__ << "." << __GNUC_PATCHLEVEL__;
+#elif defined(_MSC_VER)
+        oss << "msvc " << _MSC_VER;
+#else
+        oss << "unknown";
+#endif
+        return oss.str();
+    }
+
+    void WriteJson(std::ostream &out, const std::vector<Result> &results, const Options &options)
+    {
+        out << "{\n";
+        out << "  \"context\": {\n";
+        out << "    \"engine_version\": \"" << SF::Engine::Engine_VERSION << "\",\n";
+        out << "    \"compiler\": \"" << JsonEscape(CompilerName()) << "\",\n";
+#if defined(NDEBUG)
+        out << "    \"build_type\": \"release\",\n";
+#else
+        out << "    \"build_type\": \"debug\",\n";
+#endif
+        out << "    \"simd_width\": " << SFTL::Simd::VectorWidth << ",\n";
+        out << "    \"samples\": " << options.samples << ",\n";
+        out << "    \"min_sample_ms\": " << options.minSampleMs << "\n";
+        out << "  },\n";
+        out << "  \"benchmarks\": [";
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result &result = results[i];
+            out << (i == 0 ? "\n" : ",\n");
+            out << "    {\"group\": \"" << JsonEscape(result.group) << "\", "
+                << "\"name\": \"" << JsonEscape(result.name) << "\", "
+                << "\"iterations\": " << result.iterations << ", "
+                << "\"samples\": " << result.samples << ", "
+                << "\"min_ns\": " << result.minNs << ", "
+                << "\"median_ns\": " << result.medianNs << ", "
+                << "\"mean_ns\": " << result.meanNs << ", "
+                << "\"max_ns\": " << result.maxNs << ", "
+                << "\"stddev_ns\": " << result.stddevNs << "}";
+        }
+
+        out << (results.empty() ? "]\n" : "\n  ]\n");
+        out << "}\n";
+    }
+
+    void PrintUsage(const char *argv0)
+    {
+        std::cerr << "Usage: " << argv0 << " [options]\n"
+                  << "  --filter <text>      Only run benchmarks whose group/name contains text\n"
+                  << "  --samples <n>        Timed samples per benchmark (default 15)\n"
+                  << "  --min-time-ms <ms>   Minimum duration of one sample (default 10)\n"
+                  << "  --out <file>         Write the JSON report to file instead of stdout\n"
+                  << "  --list               List benchmarks and exit\n";
+    }
+
+    bool ParseOptions(int argc, char **argv, Options &options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+            const bool hasValue = i + 1 < argc;
+
+            if (arg == "--filter" && hasValue)
+                options.filter = argv[++i];
+            else if (arg == "--samples" && hasValue)
+                options.samples = std::max(1, std::atoi(argv[++i]));
+            else if (arg == "--min-time-ms" && hasValue)
+                options.minSampleMs = std::max(0.01, std::atof(argv[++i]));
+            else if (arg == "--out" && hasValue)
+                options.outputPath = argv[++i];
+            else if (arg == "--list")
+                options.list = true;
+            else
+                return false;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<const Benchmark *> selected;
+    for (const Benchmark &benchmark : Registry())
+    {
+        const std::string fullName = std::string(benchmark.group) + "/" + std::string(benchmark.name);
+        if (options.filter.empty() || fullName.find(options.filter) != std::string::npos)
+            selected.push_back(&benchmark);
+    }
+
+    if (options.list)
+    {
+        for (const Benchmark *benchmark : selected)
+            std::cout << benchmark->group << "/" << benchmark->name << "\n";
+        return 0;
+    }
+
+    std::vector<Result> results;
+    results.reserve(selected.size());
+    for (const Benchmark *benchmark : selected)
+    {
+        // Progress goes to stderr so stdout stays valid JSON
+        std::cerr << benchmark->group << "/" << benchmark->name << "..." << std::flush;
+        results.push_back(Run(*benchmark, options));
+        std::cerr << " " << results.back().medianNs << " ns\n";
+    }
+
+    if (options.outputPath.empty())
+    {
+        WriteJson(std::cout, results, options);
+    }
+    else
+    {
+        std::ofstream file(options.outputPath);
+        if (!file)
+        {
+            std::cerr << "Cannot open " << options.outputPath << " for writing\n";
+            return 1;
+        }
+        WriteJson(file, results, options);
+    }
+
+    return 0;
+}
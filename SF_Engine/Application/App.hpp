@@ -3,8 +3,6 @@
 #include <Files/File.hpp>
 #include <LowLevel/Rocket.hpp>
 #include <string>
-#include <locale>
-#include <codecvt>
 
 #ifdef major
 #undef major
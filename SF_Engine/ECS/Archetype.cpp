@@ -0,0 +1,86 @@
+/******************************************************************************/
+/* Archetype.cpp                                                              */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Archetype.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace SF::Engine::ECS
+{
+    namespace
+    {
+        size_t AlignUp(size_t value, size_t alignment) noexcept
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+    }
+
+    Archetype::Archetype(uint32_t id, std::vector<ComponentId> components)
+        : id(id), components(std::move(components))
+    {
+        size_t rowBytes = sizeof(Entity);
+        for (auto component : this->components)
+        {
+            infos.push_back(&ComponentRegistry::Info(component));
+            rowBytes += infos.back()->size;
+        }
+
+        if (!this->components.empty())
+            columnOf.assign(this->components.back() + 1, -1);
+        for (size_t column = 0; column < this->components.size(); ++column)
+            columnOf[this->components[column]] = static_cast<int32_t>(column);
+
+        // Largest row count whose aligned columns and change ticks still fit in one chunk
+        columnOffsets.resize(this->components.size());
+        for (capacity = static_cast<uint32_t>(ChunkSize / rowBytes); capacity > 0; --capacity)
+        {
+            size_t offset = sizeof(Entity) * capacity;
+            for (size_t column = 0; column < infos.size(); ++column)
+            {
+                offset = AlignUp(offset, infos[column]->alignment);
+                columnOffsets[column] = static_cast<uint32_t>(offset);
+                offset += size_t(infos[column]->size) * capacity;
+            }
+
+            offset = AlignUp(offset, alignof(uint64_t));
+            versionsOffset = static_cast<uint32_t>(offset);
+            offset += sizeof(uint64_t) * infos.size();
+            if (offset <= ChunkSize)
+                break;
+        }
+        // Every chunk would be handed out with no rows, checked in release builds too
+        if (capacity == 0)
+            throw std::length_error("Components of this archetype do not fit a single entity in one chunk");
+    }
+}
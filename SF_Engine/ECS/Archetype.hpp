@@ -0,0 +1,134 @@
+/******************************************************************************/
+/* Archetype.hpp                                                              */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <UtilityClasses/Export.hpp>
+#include <UtilityClasses/NoCopy.hpp>
+
+#include "Component.hpp"
+#include "Entity.hpp"
+
+namespace SF::Engine::ECS
+{
+    /**
+     * @brief A block of up to GetChunkCapacity() entities of one archetype, stored as SoA: the
+     * entity column, one contiguous column per component, then one change tick per component.
+     * Rows [0, count) are live.
+     */
+    struct Chunk
+    {
+        std::byte *data = nullptr;
+        uint32_t count = 0;
+    };
+
+    class World;
+
+    /**
+     * @brief All entities with exactly one set of components. Entities are packed: every chunk
+     * but the last is full, removing an entity moves the archetype's last row into its place.
+     */
+    class SF_Export Archetype : NoCopy
+    {
+    public:
+        Archetype(uint32_t id, std::vector<ComponentId> components);
+
+        uint32_t GetId() const noexcept { return id; }
+
+        /**
+         * @brief Component ids in ascending order, column i holds components[i].
+         */
+        std::span<const ComponentId> GetComponents() const noexcept { return components; }
+
+        bool Has(ComponentId component) const noexcept { return GetColumn(component) >= 0; }
+
+        /**
+         * @brief Column of a component, -1 when the archetype does not have it.
+         */
+        int32_t GetColumn(ComponentId component) const noexcept
+        {
+            return component < columnOf.size() ? columnOf[component] : -1;
+        }
+
+        uint32_t GetChunkCapacity() const noexcept { return capacity; }
+        size_t GetChunkCount() const noexcept { return chunks.size(); }
+        const Chunk &GetChunk(size_t index) const noexcept { return chunks[index]; }
+        size_t GetEntityCount() const noexcept { return entityCount; }
+
+        Entity *GetEntities(const Chunk &chunk) const noexcept { return reinterpret_cast<Entity *>(chunk.data); }
+
+        void *GetColumnData(const Chunk &chunk, size_t column) const noexcept { return chunk.data + columnOffsets[column]; }
+
+        template <typename T>
+        T *GetColumnData(const Chunk &chunk, size_t column) const noexcept
+        {
+            return reinterpret_cast<T *>(GetColumnData(chunk, column));
+        }
+
+        void *GetComponentData(const Chunk &chunk, size_t column, uint32_t row) const noexcept
+        {
+            return chunk.data + columnOffsets[column] + size_t(row) * infos[column]->size;
+        }
+
+        /**
+         * @brief World change tick of the last write to each column of the chunk, indexed by column.
+         */
+        uint64_t *GetVersions(const Chunk &chunk) const noexcept { return reinterpret_cast<uint64_t *>(chunk.data + versionsOffset); }
+
+        uint64_t GetVersion(const Chunk &chunk, size_t column) const noexcept { return GetVersions(chunk)[column]; }
+
+    private:
+        friend class World;
+
+        uint32_t id;
+        std::vector<ComponentId> components;
+        std::vector<const ComponentInfo *> infos;
+        std::vector<uint32_t> columnOffsets;
+        std::vector<int32_t> columnOf; // Indexed by ComponentId
+        uint32_t versionsOffset = 0;
+        uint32_t capacity = 0;
+
+        std::vector<Chunk> chunks;
+        size_t entityCount = 0;
+
+        // Archetype reached by adding or removing one component, filled in on first use
+        std::unordered_map<ComponentId, Archetype *> addEdges;
+        std::unordered_map<ComponentId, Archetype *> removeEdges;
+    };
+}
@@ -0,0 +1,76 @@
+/******************************************************************************/
+/* Component.cpp                                                              */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Component.hpp"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <stdexcept>
+
+namespace SF::Engine::ECS
+{
+    namespace
+    {
+        // Constant-initialized, so Id() is safe from other translation units' static initializers.
+        // Fixed storage: readers never race a reallocation while another type registers
+        constinit std::array<ComponentInfo, ComponentRegistry::MaxComponents> infos{};
+        constinit std::atomic<size_t> count{0};
+        constinit std::mutex mutex;
+    }
+
+    const ComponentInfo &ComponentRegistry::Info(ComponentId id) noexcept
+    {
+        assert(id < Count());
+        return infos[id];
+    }
+
+    size_t ComponentRegistry::Count() noexcept
+    {
+        return count.load(std::memory_order_acquire);
+    }
+
+    ComponentId ComponentRegistry::Register(const ComponentInfo &info)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        const size_t id = count.load(std::memory_order_relaxed);
+        // Checked in release builds too, the store below would run past the array
+        if (id >= MaxComponents)
+            throw std::length_error("More component types than ComponentRegistry::MaxComponents");
+        infos[id] = info;
+        count.store(id + 1, std::memory_order_release);
+        return static_cast<ComponentId>(id);
+    }
+}
@@ -0,0 +1,167 @@
+/******************************************************************************/
+/* Component.hpp                                                              */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <UtilityClasses/Export.hpp>
+#include <UtilityClasses/TypeInformation.hpp>
+
+#include "Entity.hpp"
+
+namespace SF::Engine::ECS
+{
+    using ComponentId = uint32_t;
+
+    /**
+     * @brief Every chunk is one block of this size, whatever its archetype.
+     */
+    inline constexpr size_t ChunkSize = 16 * 1024;
+    inline constexpr size_t ChunkAlignment = 64;
+
+    /**
+     * @brief Type-erased lifetime operations of a component type, the only way archetype chunks
+     * touch component memory.
+     */
+    struct ComponentInfo
+    {
+        std::string_view name;
+        uint32_t size = 0;
+        uint32_t alignment = 0;
+        bool trivial = false; // Trivially copyable and destructible: relocation is a memcpy and destruction a no-op
+
+        void (*construct)(void *destination) = nullptr;                 // Default construction, null if T has none
+        void (*copy)(void *destination, const void *source) = nullptr;  // Copy construction, null if T has none
+        void (*relocate)(void *destination, void *source) = nullptr;    // Move construct into destination, then destroy source
+        void (*destroy)(void *object) = nullptr;
+
+        void Relocate(void *destination, void *source, size_t count) const
+        {
+            if (trivial)
+            {
+                std::memcpy(destination, source, size * count);
+                return;
+            }
+            for (size_t i = 0; i < count; ++i)
+                relocate(static_cast<std::byte *>(destination) + i * size, static_cast<std::byte *>(source) + i * size);
+        }
+
+        void Destroy(void *objects, size_t count) const
+        {
+            if (trivial)
+                return;
+            for (size_t i = 0; i < count; ++i)
+                destroy(static_cast<std::byte *>(objects) + i * size);
+        }
+    };
+
+    namespace detail
+    {
+        // Bytes of a one-row chunk holding only this component, padding included, laid out as Archetype does
+        constexpr size_t SingleRowChunkBytes(size_t size, size_t alignment) noexcept
+        {
+            const size_t column = (sizeof(Entity) + alignment - 1) / alignment * alignment;
+            const size_t versions = (column + size + alignof(uint64_t) - 1) / alignof(uint64_t) * alignof(uint64_t);
+            return versions + sizeof(uint64_t);
+        }
+    }
+
+    /**
+     * @brief Any object type can be a component; chunks are 64 byte aligned so that is the limit,
+     * and one entity with the component alone, after alignment padding, has to fit in a chunk.
+     */
+    template <typename T>
+    concept ComponentType = std::is_object_v<T> && !std::is_const_v<T> && !std::is_array_v<T> &&
+                            std::is_move_constructible_v<T> && std::is_destructible_v<T> && alignof(T) <= ChunkAlignment &&
+                            detail::SingleRowChunkBytes(sizeof(T), alignof(T)) <= ChunkSize;
+
+    /**
+     * @brief Process-wide component ids, assigned on first use of each type.
+     */
+    class SF_Export ComponentRegistry
+    {
+    public:
+        static constexpr size_t MaxComponents = 1024;
+
+        template <ComponentType T>
+        static ComponentId Id()
+        {
+            static const ComponentId id = Register(Make<T>());
+            return id;
+        }
+
+        static const ComponentInfo &Info(ComponentId id) noexcept;
+        static size_t Count() noexcept;
+
+    private:
+        template <typename T>
+        static ComponentInfo Make()
+        {
+            ComponentInfo info;
+            info.name = TypeName<T>();
+            info.size = static_cast<uint32_t>(sizeof(T));
+            info.alignment = static_cast<uint32_t>(alignof(T));
+            info.trivial = std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>;
+
+            if constexpr (std::is_default_constructible_v<T>)
+                info.construct = [](void *destination)
+                { new (destination) T(); };
+            if constexpr (std::is_copy_constructible_v<T>)
+                info.copy = [](void *destination, const void *source)
+                { new (destination) T(*static_cast<const T *>(source)); };
+            info.relocate = [](void *destination, void *source)
+            {
+                new (destination) T(std::move(*static_cast<T *>(source)));
+                static_cast<T *>(source)->~T();
+            };
+            info.destroy = [](void *object)
+            { static_cast<T *>(object)->~T(); };
+            return info;
+        }
+
+        // Defined in Component.cpp so the engine and everything linking it share one registry
+        static ComponentId Register(const ComponentInfo &info);
+    };
+
+    template <typename T>
+    inline ComponentId GetComponentId()
+    {
+        return ComponentRegistry::Id<std::remove_const_t<T>>();
+    }
+}
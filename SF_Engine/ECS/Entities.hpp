@@ -0,0 +1,75 @@
+/******************************************************************************/
+/* Entities.hpp                                                               */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <Engine/Module.hpp>
+
+#include <UtilityClasses/ThreadPool.hpp>
+
+#include "Scheduler.hpp"
+#include "World.hpp"
+
+namespace SF::Engine
+{
+    /**
+     * @brief Module owning the game's ECS world and running its systems every update.
+     */
+    class Entities : public Module::Registrar<Entities>
+    {
+        // Register the module
+        inline static const bool Registered =
+            ModuleFactory<Module>::RegisterModule<Entities>(Module::Stage::Normal);
+
+    public:
+        Entities();
+
+        void Update() override;
+
+        Stage GetStage() const override { return Stage::Normal; }
+        TypeId GetTypeId() const override { return TypeInfo<Module>::GetTypeId<Entities>(); }
+        std::string_view GetName() const override { return "Entities"; }
+
+        ECS::World &GetWorld() noexcept { return world; }
+        const ECS::World &GetWorld() const noexcept { return world; }
+
+        ECS::Scheduler &GetScheduler() noexcept { return scheduler; }
+
+    private:
+        ECS::World world;
+        ECS::Scheduler scheduler;
+
+        // Workers helping the updating thread with system jobs
+        ThreadPool jobs;
+    };
+}
@@ -0,0 +1,72 @@
+/******************************************************************************/
+/* Entity.hpp                                                                 */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace SF::Engine::ECS
+{
+    /**
+     * @brief Handle to an entity of a World. The generation tells a reused index apart from the
+     * destroyed entity that held it before, so stale handles are detected instead of aliasing.
+     */
+    struct Entity
+    {
+        static constexpr uint32_t NullIndex = ~uint32_t(0);
+
+        uint32_t index = NullIndex;
+        uint32_t generation = 0;
+
+        static constexpr Entity Null() noexcept { return {}; }
+        constexpr bool IsNull() const noexcept { return index == NullIndex; }
+
+        constexpr bool operator==(const Entity &other) const noexcept = default;
+
+        /**
+         * @brief Both halves in one value, for hashing and logging.
+         */
+        constexpr uint64_t Value() const noexcept { return (uint64_t(generation) << 32) | index; }
+    };
+}
+
+template <>
+struct std::hash<SF::Engine::ECS::Entity>
+{
+    size_t operator()(const SF::Engine::ECS::Entity &entity) const noexcept
+    {
+        return std::hash<uint64_t>{}(entity.Value());
+    }
+};
@@ -0,0 +1,217 @@
+/******************************************************************************/
+/* Query.hpp                                                                  */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Archetype.hpp"
+#include "Component.hpp"
+#include "World.hpp"
+
+namespace SF::Engine::ECS
+{
+    /**
+     * @brief A cached view over the entities having all of Cs, const Cs being only read.
+     *
+     * The matching archetypes are kept between runs and only archetypes created since the last
+     * run are checked, so a run never rescans the whole world. Each run stamps the chunks it
+     * visits as changed for its non-const components. With a change filter, a run only visits
+     * chunks where one of the filtered components changed since the query's previous run; its
+     * own writes do not count. The filter is per chunk, so unchanged entities sharing a chunk
+     * with a changed one are visited too.
+     */
+    template <typename... Cs>
+    class Query
+    {
+        static_assert(detail::AreUnique<std::remove_const_t<Cs>...>::value, "A component type can only be given once");
+
+    public:
+        explicit Query(World &world) : world(&world) {}
+
+        /**
+         * @brief Only visits chunks where one of Ts changed since the previous run. Ts do not
+         * need to be part of Cs, archetypes without them are skipped.
+         */
+        template <typename... Ts>
+        Query &SetChangeFilter()
+        {
+            SetChangeFilter({GetComponentId<std::remove_const_t<Ts>>()...});
+            return *this;
+        }
+
+        Query &SetChangeFilter(std::vector<ComponentId> components)
+        {
+            changeFilter = std::move(components);
+            matches.clear();
+            archetypesSeen = 0;
+            return *this;
+        }
+
+        /**
+         * @brief Makes the next run see every chunk as changed.
+         */
+        void ResetChangeTracking() noexcept { lastRunTick = 0; }
+
+        uint64_t GetLastRunTick() const noexcept { return lastRunTick; }
+
+        World &GetWorld() const noexcept { return *world; }
+
+        /**
+         * @brief Calls func(const Entity *, size_t count, Cs *...) once per matching chunk.
+         */
+        template <typename Func>
+        void ForEachChunk(Func &&func);
+
+        /**
+         * @brief Calls func(Cs &...) or func(Entity, Cs &...) for every entity of the matching chunks.
+         */
+        template <typename Func>
+        void Each(Func &&func);
+
+        /**
+         * @brief Archetypes matching the query, including the empty ones.
+         */
+        size_t GetArchetypeCount()
+        {
+            Update();
+            return matches.size();
+        }
+
+    private:
+        struct Match
+        {
+            const Archetype *archetype;
+            std::array<int32_t, sizeof...(Cs) + 1> columns;
+            std::vector<int32_t> filterColumns;
+        };
+
+        // Matches the archetypes created since the last update
+        void Update();
+
+        World *world;
+        std::vector<Match> matches;
+        size_t archetypesSeen = 0;
+
+        std::vector<ComponentId> changeFilter;
+        uint64_t lastRunTick = 0;
+    };
+
+    template <typename... Cs>
+    void Query<Cs...>::Update()
+    {
+        const ComponentId ids[] = {GetComponentId<std::remove_const_t<Cs>>()..., 0};
+
+        for (; archetypesSeen < world->GetArchetypeCount(); ++archetypesSeen)
+        {
+            const Archetype &archetype = world->GetArchetype(archetypesSeen);
+
+            Match match{&archetype, {}, {}};
+            bool matched = true;
+            for (size_t i = 0; i < sizeof...(Cs) && matched; ++i)
+            {
+                match.columns[i] = archetype.GetColumn(ids[i]);
+                matched = match.columns[i] >= 0;
+            }
+            for (size_t i = 0; i < changeFilter.size() && matched; ++i)
+            {
+                match.filterColumns.push_back(archetype.GetColumn(changeFilter[i]));
+                matched = match.filterColumns.back() >= 0;
+            }
+
+            if (matched)
+                matches.push_back(std::move(match));
+        }
+    }
+
+    template <typename... Cs>
+    template <typename Func>
+    void Query<Cs...>::ForEachChunk(Func &&func)
+    {
+        Update();
+
+        const uint64_t runTick = world->BeginQueryRun();
+        world->iterationDepth.fetch_add(1, std::memory_order_relaxed);
+        for (const Match &match : matches)
+        {
+            const Archetype &archetype = *match.archetype;
+            for (size_t index = 0; index < archetype.GetChunkCount(); ++index)
+            {
+                const Chunk &chunk = archetype.GetChunk(index);
+                uint64_t *versions = archetype.GetVersions(chunk);
+                if (!changeFilter.empty())
+                {
+                    bool changed = false;
+                    for (int32_t column : match.filterColumns)
+                        changed |= versions[column] > lastRunTick;
+                    if (!changed)
+                        continue;
+                }
+
+                [&]<size_t... I>(std::index_sequence<I...>)
+                {
+                    ([&]
+                     {
+                         if constexpr (!std::is_const_v<Cs>)
+                             versions[match.columns[I]] = runTick; }(),
+                     ...);
+                    func(static_cast<const Entity *>(archetype.GetEntities(chunk)), size_t(chunk.count),
+                         archetype.GetColumnData<std::remove_const_t<Cs>>(chunk, match.columns[I])...);
+                }(std::index_sequence_for<Cs...>{});
+            }
+        }
+        world->iterationDepth.fetch_sub(1, std::memory_order_relaxed);
+
+        lastRunTick = runTick;
+    }
+
+    template <typename... Cs>
+    template <typename Func>
+    void Query<Cs...>::Each(Func &&func)
+    {
+        ForEachChunk([&](const Entity *entities, size_t count, Cs *...columns)
+                     {
+                         for (size_t row = 0; row < count; ++row)
+                         {
+                             if constexpr (std::is_invocable_v<Func &, Entity, Cs &...>)
+                                 func(entities[row], columns[row]...);
+                             else
+                                 func(columns[row]...);
+                         } });
+    }
+}
@@ -0,0 +1,202 @@
+/******************************************************************************/
+/* Scheduler.cpp                                                              */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Scheduler.hpp"
+
+#include <algorithm>
+#include <future>
+
+namespace SF::Engine::ECS
+{
+    namespace
+    {
+        bool Intersects(const std::vector<ComponentId> &a, const std::vector<ComponentId> &b) noexcept
+        {
+            auto left = a.begin();
+            auto right = b.begin();
+            while (left != a.end() && right != b.end())
+            {
+                if (*left == *right)
+                    return true;
+                if (*left < *right)
+                    ++left;
+                else
+                    ++right;
+            }
+            return false;
+        }
+
+        void SortUnique(std::vector<ComponentId> &ids)
+        {
+            std::sort(ids.begin(), ids.end());
+            ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        }
+    }
+
+    bool ComponentAccess::Conflicts(const ComponentAccess &other) const noexcept
+    {
+        if (exclusive || other.exclusive)
+            return true;
+        return Intersects(writes, other.writes) || Intersects(writes, other.reads) || Intersects(reads, other.writes);
+    }
+
+    SystemId Scheduler::AddExclusive(std::string name, std::function<void(World &)> func)
+    {
+        auto system = std::make_unique<detail::ExclusiveSystem>(std::move(func));
+        system->access.exclusive = true;
+        return AddSystem(std::move(name), std::move(system));
+    }
+
+    SystemId Scheduler::AddSystem(std::string name, std::unique_ptr<detail::SystemBase> system)
+    {
+        system->name = std::move(name);
+        SortUnique(system->access.reads);
+        SortUnique(system->access.writes);
+
+        systems.push_back(std::move(system));
+        return static_cast<SystemId>(systems.size() - 1);
+    }
+
+    void Scheduler::BuildWaves()
+    {
+        // A system goes one wave after the latest earlier system it conflicts with, which keeps
+        // conflicting systems in registration order and lets the others move forward
+        waves.clear();
+        std::vector<uint32_t> waveOf(systems.size(), 0);
+        for (SystemId system = 0; system < systems.size(); ++system)
+        {
+            if (!systems[system]->enabled)
+                continue;
+
+            uint32_t wave = 0;
+            for (SystemId earlier = 0; earlier < system; ++earlier)
+            {
+                if (systems[earlier]->enabled && systems[system]->access.Conflicts(systems[earlier]->access))
+                    wave = std::max(wave, waveOf[earlier] + 1);
+            }
+
+            waveOf[system] = wave;
+            if (wave >= waves.size())
+                waves.resize(wave + 1);
+            waves[wave].push_back(system);
+        }
+    }
+
+    uint32_t Scheduler::GetChunksPerJob(size_t chunkCount, size_t workerCount) const noexcept
+    {
+        if (options.chunksPerJob != 0)
+            return options.chunksPerJob;
+        if (options.deterministic)
+            return 4;
+
+        // A few jobs per thread so uneven chunks still balance out
+        const size_t targetJobs = (workerCount + 1) * 4;
+        return static_cast<uint32_t>(std::max<size_t>(1, (chunkCount + targetJobs - 1) / targetJobs));
+    }
+
+    void Scheduler::RunWave(World &world, const std::vector<SystemId> &wave, ThreadPool *pool)
+    {
+        const size_t workerCount = pool ? pool->GetWorkers().size() : 0;
+
+        // Chunks are gathered up front on this thread, jobs only touch component data
+        jobs.clear();
+        for (SystemId id : wave)
+        {
+            detail::SystemBase *system = systems[id].get();
+            const size_t chunkCount = system->Prepare(world);
+            if (chunkCount == 0)
+                continue;
+
+            const size_t perJob = system->access.exclusive ? chunkCount : GetChunksPerJob(chunkCount, workerCount);
+            const uint32_t jobCount = static_cast<uint32_t>((chunkCount + perJob - 1) / perJob);
+            for (uint32_t job = 0; job < jobCount; ++job)
+            {
+                const size_t first = job * perJob;
+                jobs.push_back({system, first, std::min(chunkCount, first + perJob), {job, jobCount}});
+            }
+        }
+
+        if (workerCount == 0 || jobs.size() <= 1)
+        {
+            for (const Job &job : jobs)
+                job.system->Run(world, job.first, job.last, job.info);
+            return;
+        }
+
+        // The calling thread takes the first job rather than idling
+        std::vector<std::future<void>> pending;
+        pending.reserve(jobs.size() - 1);
+        for (size_t i = 1; i < jobs.size(); ++i)
+        {
+            const Job &job = jobs[i];
+            pending.push_back(pool->Enqueue([&world, job]
+                                            { job.system->Run(world, job.first, job.last, job.info); }));
+        }
+
+        std::exception_ptr error;
+        try
+        {
+            jobs.front().system->Run(world, jobs.front().first, jobs.front().last, jobs.front().info);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        // Every job has to finish before an exception leaves, they reference this wave's state
+        for (auto &future : pending)
+            future.wait();
+        for (auto &future : pending)
+        {
+            try
+            {
+                future.get();
+            }
+            catch (...)
+            {
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    void Scheduler::Run(World &world, ThreadPool *pool)
+    {
+        BuildWaves();
+        for (const auto &wave : waves)
+            RunWave(world, wave, pool);
+    }
+}
@@ -0,0 +1,270 @@
+/******************************************************************************/
+/* Scheduler.hpp                                                              */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <UtilityClasses/Export.hpp>
+#include <UtilityClasses/NoCopy.hpp>
+#include <UtilityClasses/ThreadPool.hpp>
+
+#include "Component.hpp"
+#include "Query.hpp"
+#include "World.hpp"
+
+namespace SF::Engine::ECS
+{
+    using SystemId = uint32_t;
+
+    /**
+     * @brief Components a system reads and writes, both sorted without duplicates.
+     */
+    struct SF_Export ComponentAccess
+    {
+        std::vector<ComponentId> reads;
+        std::vector<ComponentId> writes;
+
+        // Exclusive systems may change the world's structure and conflict with every system
+        bool exclusive = false;
+
+        /**
+         * @brief Whether the two may not run at the same time: one writes what the other touches.
+         */
+        bool Conflicts(const ComponentAccess &other) const noexcept;
+    };
+
+    /**
+     * @brief The slice of a system's chunks one job covers.
+     */
+    struct JobInfo
+    {
+        uint32_t index;
+        uint32_t count;
+    };
+
+    struct SchedulerOptions
+    {
+        // Splits systems into jobs of a fixed chunksPerJob instead of by worker count, so the same
+        // world always gives the same job boundaries and JobInfo whatever the machine
+        bool deterministic = false;
+
+        // Chunks per job, 0 picks a size from the worker count (or 4 when deterministic)
+        uint32_t chunksPerJob = 0;
+    };
+
+    namespace detail
+    {
+        class SystemBase
+        {
+        public:
+            virtual ~SystemBase() = default;
+
+            // Gathers the chunks to process on the calling thread, returns their count
+            virtual size_t Prepare(World &world) = 0;
+
+            // Runs the system over the prepared chunks [first, last)
+            virtual void Run(World &world, size_t first, size_t last, JobInfo job) = 0;
+
+            virtual void SetChangeFilter(std::vector<ComponentId> components) = 0;
+
+            std::string name;
+            ComponentAccess access;
+            bool enabled = true;
+        };
+
+        template <typename Func, typename... Cs>
+        class ChunkSystem final : public SystemBase
+        {
+        public:
+            explicit ChunkSystem(Func func) : func(std::move(func)) {}
+
+            size_t Prepare(World &world) override
+            {
+                if (!query || &query->GetWorld() != &world)
+                {
+                    query.emplace(world);
+                    query->SetChangeFilter(changeFilter);
+                }
+
+                chunks.clear();
+                query->ForEachChunk([&](const Entity *entities, size_t count, Cs *...columns)
+                                    { chunks.emplace_back(entities, count, columns...); });
+                return chunks.size();
+            }
+
+            void Run(World &, size_t first, size_t last, JobInfo job) override
+            {
+                for (size_t i = first; i < last; ++i)
+                {
+                    std::apply([&](const Entity *entities, size_t count, Cs *...columns)
+                               {
+                                   if constexpr (std::is_invocable_v<Func &, const JobInfo &, const Entity *, size_t, Cs *...>)
+                                       func(job, entities, count, columns...);
+                                   else
+                                       func(entities, count, columns...); },
+                               chunks[i]);
+                }
+            }
+
+            void SetChangeFilter(std::vector<ComponentId> components) override
+            {
+                changeFilter = std::move(components);
+                if (query)
+                    query->SetChangeFilter(changeFilter);
+            }
+
+        private:
+            Func func;
+            std::optional<Query<Cs...>> query;
+            std::vector<ComponentId> changeFilter;
+            std::vector<std::tuple<const Entity *, size_t, Cs *...>> chunks;
+        };
+
+        class ExclusiveSystem final : public SystemBase
+        {
+        public:
+            explicit ExclusiveSystem(std::function<void(World &)> func) : func(std::move(func)) {}
+
+            size_t Prepare(World &) override { return 1; }
+            void Run(World &world, size_t, size_t, JobInfo) override { func(world); }
+            void SetChangeFilter(std::vector<ComponentId>) override { assert(false && "Exclusive systems have no query to filter"); }
+
+        private:
+            std::function<void(World &)> func;
+        };
+
+        template <typename... Cs>
+        ComponentAccess AccessOf()
+        {
+            ComponentAccess access;
+            ((std::is_const_v<Cs> ? access.reads : access.writes).push_back(GetComponentId<Cs>()), ...);
+            return access;
+        }
+    }
+
+    /**
+     * @brief Runs ECS systems in parallel from the components they declare.
+     *
+     * A system is a chunk function over Cs, const Cs being read and the others written. Every
+     * Run builds the conflict graph of the enabled systems: a system follows each earlier
+     * registered system it conflicts with, so systems touching the same data always run in
+     * registration order. Systems are grouped into waves of non-conflicting systems, and each
+     * wave's chunks are split into jobs on the thread pool. A system's matching archetypes are
+     * cached in a Query between runs.
+     */
+    class SF_Export Scheduler : NoCopy
+    {
+    public:
+        explicit Scheduler(SchedulerOptions options = {}) : options(options) {}
+
+        /**
+         * @brief Adds a system calling func(const Entity *, size_t count, Cs *...) per chunk,
+         * optionally taking a leading const JobInfo &.
+         */
+        template <typename... Cs, typename Func>
+        SystemId Add(std::string name, Func &&func)
+        {
+            static_assert(detail::AreUnique<std::remove_const_t<Cs>...>::value, "A component type can only be given once");
+            auto system = std::make_unique<detail::ChunkSystem<std::decay_t<Func>, Cs...>>(std::forward<Func>(func));
+            system->access = detail::AccessOf<Cs...>();
+            return AddSystem(std::move(name), std::move(system));
+        }
+
+        /**
+         * @brief Adds a system running alone on the calling thread, free to change the world's structure.
+         */
+        SystemId AddExclusive(std::string name, std::function<void(World &)> func);
+
+        /**
+         * @brief Makes the system only visit chunks where one of Ts changed since its previous run.
+         */
+        template <typename... Ts>
+        void SetChangeFilter(SystemId system)
+        {
+            systems[system]->SetChangeFilter({GetComponentId<std::remove_const_t<Ts>>()...});
+        }
+
+        void SetEnabled(SystemId system, bool enabled) { systems[system]->enabled = enabled; }
+        bool IsEnabled(SystemId system) const { return systems[system]->enabled; }
+
+        std::string_view GetName(SystemId system) const { return systems[system]->name; }
+        const ComponentAccess &GetAccess(SystemId system) const { return systems[system]->access; }
+        size_t GetSystemCount() const noexcept { return systems.size(); }
+
+        void SetOptions(SchedulerOptions newOptions) noexcept { options = newOptions; }
+        const SchedulerOptions &GetOptions() const noexcept { return options; }
+
+        /**
+         * @brief Runs every enabled system once. Without a pool, or with one without workers,
+         * everything runs on the calling thread in the same order.
+         */
+        void Run(World &world, ThreadPool *pool = nullptr);
+
+        /**
+         * @brief Waves of the last Run, each a list of systems that ran side by side.
+         */
+        const std::vector<std::vector<SystemId>> &GetWaves() const noexcept { return waves; }
+
+    private:
+        struct Job
+        {
+            detail::SystemBase *system;
+            size_t first;
+            size_t last;
+            JobInfo info;
+        };
+
+        SystemId AddSystem(std::string name, std::unique_ptr<detail::SystemBase> system);
+
+        void BuildWaves();
+        void RunWave(World &world, const std::vector<SystemId> &wave, ThreadPool *pool);
+        uint32_t GetChunksPerJob(size_t chunkCount, size_t workerCount) const noexcept;
+
+        SchedulerOptions options;
+        std::vector<std::unique_ptr<detail::SystemBase>> systems;
+
+        std::vector<std::vector<SystemId>> waves;
+        std::vector<Job> jobs;
+    };
+}
@@ -0,0 +1,327 @@
+/******************************************************************************/
+/* World.cpp                                                                  */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "World.hpp"
+
+#include <new>
+
+namespace SF::Engine::ECS
+{
+    World::World()
+    {
+        emptyArchetype = &GetOrCreateArchetype({});
+    }
+
+    World::~World()
+    {
+        Clear();
+
+        for (std::byte *memory : freeChunks)
+            ::operator delete(memory, std::align_val_t(ChunkAlignment));
+    }
+
+    Archetype &World::GetOrCreateArchetype(std::vector<ComponentId> components)
+    {
+        std::sort(components.begin(), components.end());
+        assert(std::adjacent_find(components.begin(), components.end()) == components.end());
+
+        auto it = archetypeLookup.find(components);
+        if (it != archetypeLookup.end())
+            return *it->second;
+
+        archetypes.push_back(std::make_unique<Archetype>(static_cast<uint32_t>(archetypes.size()), components));
+        Archetype *archetype = archetypes.back().get();
+        archetypeLookup.emplace(std::move(components), archetype);
+        return *archetype;
+    }
+
+    void World::Destroy(Entity entity)
+    {
+        assert(iterationDepth.load(std::memory_order_relaxed) == 0 && "Structural change while iterating");
+        if (!IsAlive(entity))
+            return;
+
+        EntityRecord &record = records[entity.index];
+        RemoveRow(*record.archetype, record.chunk, record.row, true);
+
+        record.archetype = nullptr;
+        ++record.generation;
+        freeIndices.push_back(entity.index);
+    }
+
+    void World::DestroyBatch(std::span<const Entity> entities)
+    {
+        assert(iterationDepth.load(std::memory_order_relaxed) == 0 && "Structural change while iterating");
+
+        // Retire every row first, destroying its components and nulling its entity. Retiring the
+        // record also skips duplicates in entities
+        destroyedRows.clear();
+        for (Entity entity : entities)
+        {
+            if (!IsAlive(entity))
+                continue;
+
+            EntityRecord &record = records[entity.index];
+            Archetype &archetype = *record.archetype;
+            const Chunk &chunk = archetype.chunks[record.chunk];
+            for (size_t column = 0; column < archetype.infos.size(); ++column)
+                archetype.infos[column]->Destroy(archetype.GetComponentData(chunk, column, record.row), 1);
+            archetype.GetEntities(chunk)[record.row] = Entity::Null();
+
+            destroyedRows.push_back({&archetype, record.chunk, record.row});
+            record.archetype = nullptr;
+            ++record.generation;
+            freeIndices.push_back(entity.index);
+        }
+
+        // Once retired tail rows are dropped, the last row is live, so filling a hole never moves
+        // a destroyed row and the remaining holes keep their place. No sorting is needed
+        for (const RowLocation &location : destroyedRows)
+        {
+            Archetype &archetype = *location.archetype;
+            PopRetiredRows(archetype);
+
+            const bool dropped = location.chunk >= archetype.chunks.size() || location.row >= archetype.chunks[location.chunk].count;
+            if (!dropped)
+                RemoveRow(archetype, location.chunk, location.row, false);
+        }
+    }
+
+    void World::PopRetiredRows(Archetype &archetype) noexcept
+    {
+        while (!archetype.chunks.empty())
+        {
+            Chunk &last = archetype.chunks.back();
+            if (!archetype.GetEntities(last)[last.count - 1].IsNull())
+                return;
+
+            --last.count;
+            --archetype.entityCount;
+            if (last.count == 0)
+            {
+                FreeChunkMemory(last.data);
+                archetype.chunks.pop_back();
+            }
+        }
+    }
+
+    void World::Clear()
+    {
+        assert(iterationDepth.load(std::memory_order_relaxed) == 0 && "Structural change while iterating");
+
+        for (const auto &archetype : archetypes)
+        {
+            for (Chunk &chunk : archetype->chunks)
+            {
+                for (size_t column = 0; column < archetype->infos.size(); ++column)
+                    archetype->infos[column]->Destroy(archetype->GetColumnData(chunk, column), chunk.count);
+                FreeChunkMemory(chunk.data);
+            }
+            archetype->chunks.clear();
+            archetype->entityCount = 0;
+        }
+
+        freeIndices.clear();
+        for (uint32_t index = 0; index < records.size(); ++index)
+        {
+            EntityRecord &record = records[index];
+            if (record.archetype)
+            {
+                record.archetype = nullptr;
+                ++record.generation;
+            }
+            freeIndices.push_back(index);
+        }
+    }
+
+    World::RowRange World::AllocateRows(Archetype &archetype, size_t maxCount)
+    {
+        if (archetype.chunks.empty() || archetype.chunks.back().count == archetype.capacity)
+            archetype.chunks.push_back({AllocateChunkMemory(), 0});
+
+        Chunk &chunk = archetype.chunks.back();
+        const uint32_t count = static_cast<uint32_t>(std::min<size_t>(maxCount, archetype.capacity - chunk.count));
+        const RowRange range{static_cast<uint32_t>(archetype.chunks.size() - 1), chunk.count, count};
+
+        chunk.count += count;
+        archetype.entityCount += count;
+        StampChunk(archetype, chunk);
+        return range;
+    }
+
+    std::pair<Entity, World::EntityRecord *> World::CreateIn(Archetype &archetype)
+    {
+        assert(iterationDepth.load(std::memory_order_relaxed) == 0 && "Structural change while iterating");
+
+        const RowRange range = AllocateRows(archetype, 1);
+        const Entity entity = AllocateEntity(archetype, range.chunk, range.firstRow);
+        return {entity, &records[entity.index]};
+    }
+
+    Entity World::AllocateEntity(Archetype &archetype, uint32_t chunk, uint32_t row)
+    {
+        uint32_t index;
+        if (!freeIndices.empty())
+        {
+            index = freeIndices.back();
+            freeIndices.pop_back();
+        }
+        else
+        {
+            index = static_cast<uint32_t>(records.size());
+            records.emplace_back();
+        }
+
+        EntityRecord &record = records[index];
+        record.archetype = &archetype;
+        record.chunk = chunk;
+        record.row = row;
+
+        const Entity entity{index, record.generation};
+        archetype.GetEntities(archetype.chunks[chunk])[row] = entity;
+        return entity;
+    }
+
+    void World::RemoveRow(Archetype &archetype, uint32_t chunkIndex, uint32_t row, bool destroyComponents)
+    {
+        Chunk &chunk = archetype.chunks[chunkIndex];
+        Chunk &last = archetype.chunks.back();
+        const uint32_t lastRow = last.count - 1;
+
+        if (destroyComponents)
+        {
+            for (size_t column = 0; column < archetype.infos.size(); ++column)
+                archetype.infos[column]->Destroy(archetype.GetComponentData(chunk, column, row), 1);
+        }
+
+        // Keep the archetype packed: its very last row fills the hole
+        if (&chunk != &last || row != lastRow)
+        {
+            for (size_t column = 0; column < archetype.infos.size(); ++column)
+            {
+                archetype.infos[column]->Relocate(archetype.GetComponentData(chunk, column, row),
+                                                  archetype.GetComponentData(last, column, lastRow), 1);
+            }
+
+            const Entity moved = archetype.GetEntities(last)[lastRow];
+            archetype.GetEntities(chunk)[row] = moved;
+            records[moved.index].chunk = chunkIndex;
+            records[moved.index].row = row;
+            StampChunk(archetype, chunk);
+        }
+
+        --last.count;
+        --archetype.entityCount;
+        if (last.count == 0)
+        {
+            FreeChunkMemory(last.data);
+            archetype.chunks.pop_back();
+        }
+    }
+
+    void World::MoveEntity(Entity entity, Archetype &target)
+    {
+        EntityRecord &record = records[entity.index];
+        Archetype &source = *record.archetype;
+        const uint32_t sourceChunk = record.chunk;
+        const uint32_t sourceRow = record.row;
+
+        const RowRange range = AllocateRows(target, 1);
+        const Chunk &from = source.chunks[sourceChunk];
+        const Chunk &to = target.chunks[range.chunk];
+
+        for (size_t column = 0; column < source.infos.size(); ++column)
+        {
+            void *data = source.GetComponentData(from, column, sourceRow);
+            const int32_t targetColumn = target.GetColumn(source.components[column]);
+            if (targetColumn >= 0)
+                source.infos[column]->Relocate(target.GetComponentData(to, targetColumn, range.firstRow), data, 1);
+            else
+                source.infos[column]->Destroy(data, 1);
+        }
+
+        // The source row is now raw memory, filling it must not destroy anything
+        RemoveRow(source, sourceChunk, sourceRow, false);
+
+        target.GetEntities(to)[range.firstRow] = entity;
+        record.archetype = &target;
+        record.chunk = range.chunk;
+        record.row = range.firstRow;
+    }
+
+    Archetype &World::GetAddEdge(Archetype &archetype, ComponentId component)
+    {
+        auto it = archetype.addEdges.find(component);
+        if (it != archetype.addEdges.end())
+            return *it->second;
+
+        std::vector<ComponentId> components(archetype.components);
+        components.push_back(component);
+        Archetype &target = GetOrCreateArchetype(std::move(components));
+
+        archetype.addEdges.emplace(component, &target);
+        target.removeEdges.emplace(component, &archetype);
+        return target;
+    }
+
+    Archetype &World::GetRemoveEdge(Archetype &archetype, ComponentId component)
+    {
+        auto it = archetype.removeEdges.find(component);
+        if (it != archetype.removeEdges.end())
+            return *it->second;
+
+        std::vector<ComponentId> components(archetype.components);
+        components.erase(std::find(components.begin(), components.end(), component));
+        Archetype &target = GetOrCreateArchetype(std::move(components));
+
+        archetype.removeEdges.emplace(component, &target);
+        target.addEdges.emplace(component, &archetype);
+        return target;
+    }
+
+    std::byte *World::AllocateChunkMemory()
+    {
+        if (!freeChunks.empty())
+        {
+            std::byte *memory = freeChunks.back();
+            freeChunks.pop_back();
+            return memory;
+        }
+        return static_cast<std::byte *>(::operator new(ChunkSize, std::align_val_t(ChunkAlignment)));
+    }
+
+    void World::FreeChunkMemory(std::byte *memory) noexcept
+    {
+        freeChunks.push_back(memory);
+    }
+}
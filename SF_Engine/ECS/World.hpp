@@ -0,0 +1,447 @@
+/******************************************************************************/
+/* World.hpp                                                                  */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <UtilityClasses/Export.hpp>
+#include <UtilityClasses/NoCopy.hpp>
+
+#include "Archetype.hpp"
+#include "Component.hpp"
+#include "Entity.hpp"
+
+namespace SF::Engine::ECS
+{
+    namespace detail
+    {
+        template <typename... Ts>
+        struct AreUnique : std::true_type
+        {
+        };
+
+        template <typename T, typename... Ts>
+        struct AreUnique<T, Ts...> : std::bool_constant<!(std::is_same_v<T, Ts> || ...) && AreUnique<Ts...>::value>
+        {
+        };
+
+        struct ArchetypeKeyHash
+        {
+            size_t operator()(const std::vector<ComponentId> &key) const noexcept
+            {
+                uint64_t hash = 0xcbf29ce484222325ull;
+                for (ComponentId component : key)
+                    hash = (hash ^ component) * 0x100000001b3ull;
+                return static_cast<size_t>(hash);
+            }
+        };
+    }
+
+    template <typename... Cs>
+    class Query;
+
+    /**
+     * @brief Entities and their components, grouped by archetype into 16 KB SoA chunks.
+     *
+     * Adding or removing a component moves the entity to the neighbouring archetype through a
+     * cached edge, so it costs one hash lookup plus moving that entity's components. Each and
+     * ForEachChunk walk the matching archetypes chunk by chunk over contiguous columns.
+     * Structural changes (create, destroy, add, remove) are not allowed while iterating.
+     * A World is not thread-safe, iteration over it from several threads is.
+     *
+     * Every chunk column carries the change tick of its last write. Structural changes and
+     * iteration over non-const components stamp the chunks they touch, writes through Get do not
+     * unless followed by MarkChanged.
+     */
+    class SF_Export World : NoCopy
+    {
+    public:
+        World();
+        ~World();
+
+        /**
+         * @brief Creates an entity with the given components, moved or copied in.
+         */
+        template <typename... Cs>
+            requires(ComponentType<std::remove_cvref_t<Cs>> && ...)
+        Entity Create(Cs &&...components);
+
+        Entity Create() { return CreateIn(*emptyArchetype).first; }
+
+        /**
+         * @brief Creates out.size() entities sharing one archetype, each component copied from
+         * the values given. Fills chunks a whole run of rows at a time.
+         */
+        template <ComponentType... Cs>
+        void CreateBatch(std::span<Entity> out, const Cs &...values);
+
+        template <ComponentType... Cs>
+        std::vector<Entity> CreateBatch(size_t count, const Cs &...values)
+        {
+            std::vector<Entity> entities(count);
+            CreateBatch<Cs...>(std::span<Entity>(entities), values...);
+            return entities;
+        }
+
+        void Destroy(Entity entity);
+
+        /**
+         * @brief Destroys every entity of entities that is still alive. All rows are retired
+         * first, then the holes are filled from live tail rows: destroyed rows at an archetype's
+         * tail, and whole trailing chunks, are dropped without moving anything.
+         */
+        void DestroyBatch(std::span<const Entity> entities);
+
+        /**
+         * @brief Destroys every entity, keeping archetypes and chunk memory for reuse.
+         */
+        void Clear();
+
+        bool IsAlive(Entity entity) const noexcept
+        {
+            return entity.index < records.size() && records[entity.index].generation == entity.generation &&
+                   records[entity.index].archetype != nullptr;
+        }
+
+        /**
+         * @brief Adds a component, or assigns it when the entity already has one.
+         */
+        template <ComponentType T>
+        T &Add(Entity entity, T value = T());
+
+        template <ComponentType T>
+        void Remove(Entity entity);
+
+        template <typename T>
+        bool Has(Entity entity) const
+        {
+            return IsAlive(entity) && records[entity.index].archetype->Has(GetComponentId<T>());
+        }
+
+        /**
+         * @brief The entity's component, nullptr when it is dead or has none.
+         * Valid until the next structural change.
+         */
+        template <typename T>
+        T *Get(Entity entity) const;
+
+        /**
+         * @brief Stamps the chunk holding the entity's T as changed, for writes made through Get.
+         */
+        template <typename T>
+        void MarkChanged(Entity entity);
+
+        /**
+         * @brief Tick of the latest query run, writes made from now on are stamped one past it.
+         */
+        uint64_t GetChangeTick() const noexcept { return changeTick.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Calls func(Cs &...) or func(Entity, Cs &...) for every entity having all of Cs.
+         * const components are only read, which the scheduler uses to run systems side by side.
+         */
+        template <typename... Cs, typename Func>
+        void Each(Func &&func);
+
+        /**
+         * @brief Calls func(const Entity *, size_t count, Cs *...) once per chunk of entities
+         * having all of Cs, with the chunk's columns. The loop body is the caller's.
+         */
+        template <typename... Cs, typename Func>
+        void ForEachChunk(Func &&func);
+
+        size_t GetEntityCount() const noexcept { return records.size() - freeIndices.size(); }
+        size_t GetArchetypeCount() const noexcept { return archetypes.size(); }
+        const Archetype &GetArchetype(size_t index) const noexcept { return *archetypes[index]; }
+
+        /**
+         * @brief Archetype holding exactly these components, created when missing.
+         * Throws std::length_error when one entity with all of them does not fit in a chunk.
+         */
+        Archetype &GetOrCreateArchetype(std::vector<ComponentId> components);
+
+    private:
+        template <typename... Cs>
+        friend class Query;
+
+        struct EntityRecord
+        {
+            Archetype *archetype = nullptr;
+            uint32_t chunk = 0;
+            uint32_t row = 0;
+            uint32_t generation = 0;
+        };
+
+        struct RowRange
+        {
+            uint32_t chunk;
+            uint32_t firstRow;
+            uint32_t count;
+        };
+
+        struct RowLocation
+        {
+            Archetype *archetype;
+            uint32_t chunk;
+            uint32_t row;
+        };
+
+        // Appends up to maxCount rows to the archetype's last chunk, or a new one when it is full
+        RowRange AllocateRows(Archetype &archetype, size_t maxCount);
+        std::pair<Entity, EntityRecord *> CreateIn(Archetype &archetype);
+        Entity AllocateEntity(Archetype &archetype, uint32_t chunk, uint32_t row);
+
+        // Fills the hole at (chunk, row) with the archetype's last row; destroys the row's components first when asked
+        void RemoveRow(Archetype &archetype, uint32_t chunk, uint32_t row, bool destroyComponents);
+
+        // Drops the archetype's last rows while they hold a null entity, freeing emptied chunks
+        void PopRetiredRows(Archetype &archetype) noexcept;
+
+        // Moves an entity to target, relocating shared components and destroying the ones target lacks.
+        // Components only target has are left unconstructed for the caller
+        void MoveEntity(Entity entity, Archetype &target);
+
+        Archetype &GetAddEdge(Archetype &archetype, ComponentId component);
+        Archetype &GetRemoveEdge(Archetype &archetype, ComponentId component);
+
+        std::byte *AllocateChunkMemory();
+        void FreeChunkMemory(std::byte *memory) noexcept;
+
+        template <typename... Cs, typename Func>
+        void ForEachMatchingChunk(Func &&func);
+
+        uint64_t GetWriteTick() const noexcept { return GetChangeTick() + 1; }
+
+        // Hands out the tick a query run stamps its writes with
+        uint64_t BeginQueryRun() noexcept { return changeTick.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+        void StampChunk(const Archetype &archetype, const Chunk &chunk) const noexcept
+        {
+            std::fill_n(archetype.GetVersions(chunk), archetype.infos.size(), GetWriteTick());
+        }
+
+        std::vector<EntityRecord> records;
+        std::vector<uint32_t> freeIndices;
+
+        std::vector<std::unique_ptr<Archetype>> archetypes;
+        std::unordered_map<std::vector<ComponentId>, Archetype *, detail::ArchetypeKeyHash> archetypeLookup;
+        Archetype *emptyArchetype = nullptr;
+
+        std::vector<std::byte *> freeChunks;
+        std::vector<RowLocation> destroyedRows; // DestroyBatch scratch
+        // Atomic since systems may iterate the same world from several threads
+        std::atomic<uint32_t> iterationDepth = 0;
+        std::atomic<uint64_t> changeTick = 0;
+    };
+
+    template <typename... Cs>
+        requires(ComponentType<std::remove_cvref_t<Cs>> && ...)
+    Entity World::Create(Cs &&...components)
+    {
+        static_assert(detail::AreUnique<std::decay_t<Cs>...>::value, "A component type can only be given once");
+        assert(iterationDepth.load(std::memory_order_relaxed) == 0 && "Structural change while iterating");
+
+        Archetype &archetype = GetOrCreateArchetype({GetComponentId<std::decay_t<Cs>>()...});
+        auto [entity, record] = CreateIn(archetype);
+        const Chunk &chunk = archetype.chunks[record->chunk];
+        (new (archetype.GetComponentData(chunk, archetype.GetColumn(GetComponentId<std::decay_t<Cs>>()), record->row))
+             std::decay_t<Cs>(std::forward<Cs>(components)),
+         ...);
+        return entity;
+    }
+
+    template <ComponentType... Cs>
+    void World::CreateBatch(std::span<Entity> out, const Cs &...values)
+    {
+        static_assert(detail::AreUnique<Cs...>::value, "A component type can only be given once");
+        assert(iterationDepth.load(std::memory_order_relaxed) == 0 && "Structural change while iterating");
+
+        Archetype &archetype = GetOrCreateArchetype({GetComponentId<Cs>()...});
+        const int32_t columns[] = {archetype.GetColumn(GetComponentId<Cs>())..., 0};
+
+        size_t created = 0;
+        while (created < out.size())
+        {
+            const RowRange range = AllocateRows(archetype, out.size() - created);
+            const Chunk &chunk = archetype.chunks[range.chunk];
+
+            size_t column = 0;
+            (
+                [&](const auto &value)
+                {
+                    using C = std::remove_cvref_t<decltype(value)>;
+                    C *data = archetype.GetColumnData<C>(chunk, columns[column++]) + range.firstRow;
+                    for (uint32_t i = 0; i < range.count; ++i)
+                        new (data + i) C(value);
+                }(values),
+                ...);
+
+            for (uint32_t i = 0; i < range.count; ++i)
+                out[created + i] = AllocateEntity(archetype, range.chunk, range.firstRow + i);
+            created += range.count;
+        }
+    }
+
+    template <ComponentType T>
+    T &World::Add(Entity entity, T value)
+    {
+        assert(IsAlive(entity));
+        assert(iterationDepth.load(std::memory_order_relaxed) == 0 && "Structural change while iterating");
+
+        const ComponentId component = GetComponentId<T>();
+        EntityRecord &record = records[entity.index];
+        if (record.archetype->Has(component))
+        {
+            T &existing = *Get<T>(entity);
+            existing = std::move(value);
+            MarkChanged<T>(entity);
+            return existing;
+        }
+
+        MoveEntity(entity, GetAddEdge(*record.archetype, component));
+        Archetype &archetype = *record.archetype;
+        void *data = archetype.GetComponentData(archetype.chunks[record.chunk], archetype.GetColumn(component), record.row);
+        return *new (data) T(std::move(value));
+    }
+
+    template <ComponentType T>
+    void World::Remove(Entity entity)
+    {
+        assert(iterationDepth.load(std::memory_order_relaxed) == 0 && "Structural change while iterating");
+        if (!IsAlive(entity))
+            return;
+
+        const ComponentId component = GetComponentId<T>();
+        EntityRecord &record = records[entity.index];
+        if (record.archetype->Has(component))
+            MoveEntity(entity, GetRemoveEdge(*record.archetype, component));
+    }
+
+    template <typename T>
+    T *World::Get(Entity entity) const
+    {
+        if (!IsAlive(entity))
+            return nullptr;
+
+        const EntityRecord &record = records[entity.index];
+        const int32_t column = record.archetype->GetColumn(GetComponentId<T>());
+        if (column < 0)
+            return nullptr;
+        return static_cast<T *>(record.archetype->GetComponentData(record.archetype->chunks[record.chunk], column, record.row));
+    }
+
+    template <typename T>
+    void World::MarkChanged(Entity entity)
+    {
+        if (!IsAlive(entity))
+            return;
+
+        const EntityRecord &record = records[entity.index];
+        const int32_t column = record.archetype->GetColumn(GetComponentId<T>());
+        if (column >= 0)
+            record.archetype->GetVersions(record.archetype->chunks[record.chunk])[column] = GetWriteTick();
+    }
+
+    template <typename... Cs, typename Func>
+    void World::ForEachMatchingChunk(Func &&func)
+    {
+        const ComponentId ids[] = {GetComponentId<Cs>()..., 0};
+
+        iterationDepth.fetch_add(1, std::memory_order_relaxed);
+        for (const auto &archetype : archetypes)
+        {
+            if (archetype->entityCount == 0)
+                continue;
+
+            int32_t columns[sizeof...(Cs) + 1] = {};
+            bool matches = true;
+            for (size_t i = 0; i < sizeof...(Cs) && matches; ++i)
+            {
+                columns[i] = archetype->GetColumn(ids[i]);
+                matches = columns[i] >= 0;
+            }
+            if (!matches)
+                continue;
+
+            const uint64_t tick = GetWriteTick();
+            for (const Chunk &chunk : archetype->chunks)
+            {
+                uint64_t *versions = archetype->GetVersions(chunk);
+                size_t column = 0;
+                ([&]
+                 {
+                     if constexpr (!std::is_const_v<Cs>)
+                         versions[columns[column]] = tick;
+                     ++column; }(),
+                 ...);
+                func(*archetype, chunk, columns);
+            }
+        }
+        iterationDepth.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    template <typename... Cs, typename Func>
+    void World::ForEachChunk(Func &&func)
+    {
+        ForEachMatchingChunk<Cs...>([&](const Archetype &archetype, const Chunk &chunk, const int32_t *columns)
+                                    {
+                                        [&]<size_t... I>(std::index_sequence<I...>)
+                                        {
+                                            func(static_cast<const Entity *>(archetype.GetEntities(chunk)), size_t(chunk.count),
+                                                 archetype.GetColumnData<std::remove_const_t<Cs>>(chunk, columns[I])...);
+                                        }(std::index_sequence_for<Cs...>{}); });
+    }
+
+    template <typename... Cs, typename Func>
+    void World::Each(Func &&func)
+    {
+        ForEachChunk<Cs...>([&](const Entity *entities, size_t count, Cs *...columns)
+                            {
+                                for (size_t row = 0; row < count; ++row)
+                                {
+                                    if constexpr (std::is_invocable_v<Func &, Entity, Cs &...>)
+                                        func(entities[row], columns[row]...);
+                                    else
+                                        func(columns[row]...);
+                                } });
+    }
+}
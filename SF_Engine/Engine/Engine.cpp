@@ -1,5 +1,12 @@
 #include "Engine.hpp"
 
+#include <TemplateLibrary/Allocators.hpp>
+#include <UtilityClasses/ThreadPool.hpp>
+
+#include <algorithm>
+#include <future>
+#include <thread>
+
 namespace SF::Engine
 {
     Engine *Engine::Instance = nullptr;
@@ -10,21 +17,39 @@ namespace SF::Engine
           fpsLimit(-1.0f),
           running(true),
           elapsedUpdate(15.77ms),
-          elapsedRender(-1s)
+          elapsedRender(-1s),
+          elapsedMemory(1s)
     {
         Instance = this;
         Log::Init(Time::GetDateTime("Logs/%Y%m%d%H%M%S.txt"));
 
+        // Order the modules once, dependencies first
+        moduleGraph = ModuleGraph::Build(Module::Registry(), moduleFilter);
+
+        for (const auto &[moduleId, dependencyId] : moduleGraph.GetMissingDependencies())
+            Log::Warning("Module dependency not found: {} requires TypeId {}", Module::Registry().at(moduleId).name, dependencyId);
+
+        for (auto node : moduleGraph.GetCycle())
+            Log::Error("Module not created, it is on or depends on a dependency cycle: {}", Module::Registry().at(moduleGraph.GetId(node)).name);
+
         // Create modules from registry
-        for (auto it = Module::Registry().begin(); it != Module::Registry().end(); ++it)
-            CreateModule(it, moduleFilter);
+        for (auto node : moduleGraph.GetOrder())
+            CreateModule(moduleGraph.GetId(node));
+
+        // Hand the stages covered by a static module list to their generated update
+        SetupStaticDispatch();
 
         // Initialize all modules
-        for (auto &[id, module] : modules)
+        for (auto node : moduleGraph.GetOrder())
         {
-            if (module && !module->Initialize())
+            auto it = modules.find(moduleGraph.GetId(node));
+            if (it == modules.end() || !it->second)
+                continue;
+
+            MemoryScope scope(it->second->GetMemoryTag());
+            if (!it->second->Initialize())
             {
-                Log::Error("Failed to initialize module: {}", module->GetName());
+                Log::Error("Failed to initialize module: {}", it->second->GetName());
             }
         }
     }
@@ -33,16 +58,16 @@ namespace SF::Engine
     {
         app = nullptr;
 
-        // Shutdown modules in reverse order
-        for (auto it = modules.rbegin(); it != modules.rend(); ++it)
-        {
-            if (it->second)
-                it->second->Shutdown();
-        }
+        // Shutdown modules in reverse dependency order
+        ShutdownModules();
 
         // Destroy modules
-        for (auto it = modules.rbegin(); it != modules.rend(); ++it)
-            DestroyModule(it->first);
+        auto order = moduleGraph.GetOrder();
+        for (auto it = order.rbegin(); it != order.rend(); ++it)
+            DestroyModule(moduleGraph.GetId(*it));
+
+        // Anything still live under a module tag now was leaked by that module
+        LogMemoryReport();
 
         Log::Shutdown();
         Instance = nullptr;
@@ -52,6 +77,9 @@ namespace SF::Engine
     {
         while (running)
         {
+            // Recycles the per-thread frame scratch memory from two frames ago.
+            SFTL::FrameAllocator::BeginFrame();
+
             if (app)
             {
                 if (!app->started_)
@@ -96,43 +124,176 @@ namespace SF::Engine
                 // Updates the render delta, and render time extension.
                 deltaRender.Update();
             }
+
+            if (elapsedMemory.GetElapsed() != 0)
+                UpdateMemoryStats();
         }
 
         return EXIT_SUCCESS;
     }
 
-    void Engine::CreateModule(Module::RegistryMap::const_iterator it, const ModuleFilter &filter)
+    void Engine::CreateModule(TypeId id)
     {
-        // Check if module already exists
-        if (modules.find(it->first) != modules.end())
-            return;
-
-        // Check if module is filtered out
-        if (!filter.Check(it->first))
-            return;
+        const auto &info = Module::Registry().at(id);
 
-        // Recursively create dependencies first
-        for (auto requireId : it->second.dependencies)
+        // Create the module instance using the factory function, its constructor already charged to its tag
+        MemoryTag tag = MemoryTracker::Get().Register(info.name);
+        std::unique_ptr<Module> module;
         {
-            auto depIt = Module::Registry().find(requireId);
-            if (depIt != Module::Registry().end())
-                CreateModule(depIt, filter);
-            else
-                Log::Warning("Module dependency not found: TypeId {}", requireId);
+            MemoryScope scope(tag);
+            module = info.createFunc();
         }
 
-        // Create the module instance using the factory function
-        auto module = it->second.createFunc();
-
         if (module)
         {
-            Log::Info("Creating module: {}", it->second.name);
-            modules[it->first] = std::move(module);
-            moduleStages[it->second.stage].emplace_back(it->first);
+            Log::Info("Creating module: {}", info.name);
+            module->memoryTag = tag;
+            MemoryTracker::Get().SetBudget(tag, module->GetMemoryBudget());
+            modules[id] = std::move(module);
+            moduleStages[info.stage].emplace_back(id);
         }
         else
         {
-            Log::Error("Failed to create module: {}", it->second.name);
+            Log::Error("Failed to create module: {}", info.name);
+        }
+    }
+
+    void Engine::SetupStaticDispatch()
+    {
+        for (const auto &[stage, dispatch] : StaticDispatchRegistry())
+        {
+            if (!CanDispatchStatically(stage, dispatch.modules))
+                continue;
+
+            // The generated update now owns these modules, keep them out of the virtual loop
+            auto &stageVec = moduleStages[stage];
+            for (auto id : dispatch.modules)
+                stageVec.erase(std::remove(stageVec.begin(), stageVec.end(), id), stageVec.end());
+
+            staticUpdates[stage] = dispatch.update;
+        }
+    }
+
+    bool Engine::CanDispatchStatically(Module::Stage stage, const std::vector<TypeId> &ids) const
+    {
+        for (auto id : ids)
+        {
+            auto it = Module::Registry().find(id);
+            if (it == Module::Registry().end() || it->second.stage != stage)
+            {
+                Log::Error("Static module list disabled for stage {}: TypeId {} is not a module of that stage", static_cast<int>(stage), id);
+                return false;
+            }
+        }
+
+        // Listed modules run first and in list order, so none may transitively depend on a
+        // later listed module or on an unlisted module of the same stage
+        std::vector<bool> visited(moduleGraph.GetSize());
+        std::vector<ModuleGraph::Node> pending;
+        for (size_t index = 0; index < ids.size(); ++index)
+        {
+            auto node = moduleGraph.Find(ids[index]);
+            if (!node || modules.find(ids[index]) == modules.end())
+                continue;
+
+            std::fill(visited.begin(), visited.end(), false);
+            pending.assign(1, *node);
+            while (!pending.empty())
+            {
+                auto current = pending.back();
+                pending.pop_back();
+                for (auto dependency : moduleGraph.GetDependencies(current))
+                {
+                    if (visited[dependency])
+                        continue;
+                    visited[dependency] = true;
+                    pending.push_back(dependency);
+
+                    auto dependencyId = moduleGraph.GetId(dependency);
+                    if (modules.find(dependencyId) == modules.end() || Module::Registry().at(dependencyId).stage != stage)
+                        continue;
+
+                    auto listed = std::find(ids.begin(), ids.end(), dependencyId);
+                    if (listed == ids.end() || static_cast<size_t>(listed - ids.begin()) > index)
+                    {
+                        Log::Error("Static module list disabled for stage {}: {} must update after {}", static_cast<int>(stage),
+                                   Module::Registry().at(ids[index]).name, Module::Registry().at(dependencyId).name);
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    void Engine::ShutdownModules()
+    {
+        // Modules of one wave never depend on each other, so each wave shuts down in parallel
+        // once every later wave, which holds all of its dependents, is done
+        const size_t threads = std::min<size_t>(moduleGraph.GetMaxWaveWidth(), std::max(std::thread::hardware_concurrency(), 1u));
+        std::unique_ptr<ThreadPool> pool;
+        if (threads > 1)
+            pool = std::make_unique<ThreadPool>(static_cast<uint32_t>(threads - 1));
+
+        std::vector<Module *> parallel;
+        std::vector<std::future<void>> futures;
+        for (size_t wave = moduleGraph.GetWaveCount(); wave-- > 0;)
+        {
+            parallel.clear();
+            futures.clear();
+
+            for (auto node : moduleGraph.GetWave(wave))
+            {
+                auto it = modules.find(moduleGraph.GetId(node));
+                if (it == modules.end() || !it->second)
+                    continue;
+
+                if (pool && !it->second->RequiresMainThreadShutdown())
+                {
+                    parallel.push_back(it->second.get());
+                }
+                else
+                {
+                    MemoryScope scope(it->second->GetMemoryTag());
+                    it->second->Shutdown();
+                }
+            }
+
+            // Keep one module for this thread, it would only wait otherwise
+            for (size_t i = 1; i < parallel.size(); ++i)
+                futures.push_back(pool->Enqueue([module = parallel[i]]
+                                                {
+                                                    MemoryScope scope(module->GetMemoryTag());
+                                                    module->Shutdown(); }));
+            if (!parallel.empty())
+            {
+                MemoryScope scope(parallel.front()->GetMemoryTag());
+                parallel.front()->Shutdown();
+            }
+
+            for (auto &future : futures)
+                future.get();
+        }
+    }
+
+    void Engine::UpdateMemoryStats()
+    {
+        MemoryTracker &tracker = MemoryTracker::Get();
+        tracker.Sample();
+
+        for (auto tag : tracker.TakeBudgetViolations())
+        {
+            auto stats = tracker.GetStats(tag);
+            Log::Warning("Module {} is over its memory budget: {} bytes live, budget {} bytes", stats.name, stats.liveBytes, stats.budgetBytes);
+        }
+    }
+
+    void Engine::LogMemoryReport() const
+    {
+        for (const auto &stats : MemoryTracker::Get().GetReport())
+        {
+            Log::Info("Memory {}: {} bytes live, {} peak, {} allocations ({:.0f}/s, {:.0f} bytes/s)", stats.name, stats.liveBytes,
+                      stats.peakBytes, stats.allocationCount, stats.allocationsPerSecond, stats.bytesPerSecond);
         }
     }
 
@@ -142,23 +303,17 @@ namespace SF::Engine
         if (it == modules.end() || !it->second)
             return;
 
-        // Find and destroy all modules that depend on this module
-        for (const auto &[registrarId, registrar] : Module::Registry())
+        // Destroy all modules that depend on this module first
+        if (auto node = moduleGraph.Find(id))
         {
-            // Check if any module depends on the module we're destroying
-            auto depIt = std::find(registrar.dependencies.begin(),
-                                   registrar.dependencies.end(), id);
-            if (depIt != registrar.dependencies.end())
-                DestroyModule(registrarId);
+            for (auto dependent : moduleGraph.GetDependents(*node))
+                DestroyModule(moduleGraph.GetId(dependent));
         }
 
         // Remove from stage list
-        if (it->second)
-        {
-            auto stage = it->second->GetStage();
-            auto &stageVec = moduleStages[stage];
-            stageVec.erase(std::remove(stageVec.begin(), stageVec.end(), id), stageVec.end());
-        }
+        auto stage = it->second->GetStage();
+        auto &stageVec = moduleStages[stage];
+        stageVec.erase(std::remove(stageVec.begin(), stageVec.end(), id), stageVec.end());
 
         // Destroy the module
         modules.erase(it);
@@ -166,6 +321,11 @@ namespace SF::Engine
 
     void Engine::UpdateStage(Module::Stage stage)
     {
+        // Modules of a static module list first, through direct calls
+        auto staticIt = staticUpdates.find(stage);
+        if (staticIt != staticUpdates.end())
+            staticIt->second();
+
         auto stageIt = moduleStages.find(stage);
         if (stageIt == moduleStages.end())
             return;
@@ -174,7 +334,10 @@ namespace SF::Engine
         {
             auto modIt = modules.find(moduleId);
             if (modIt != modules.end() && modIt->second)
+            {
+                MemoryScope scope(modIt->second->GetMemoryTag());
                 modIt->second->Update();
+            }
         }
     }
 }
\ No newline at end of file
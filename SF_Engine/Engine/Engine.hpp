@@ -9,6 +9,8 @@
 #define NO_MANGLE __attribute__((visibility("default"))) extern "C"
 
 #include "Module.hpp"
+#include "ModuleGraph.hpp"
+#include "StaticModules.hpp"
 #include "Version.hpp" // If this is not found, run ```cmake .``` from root directory of this project.
 #include "Log/Log.hpp"
 
@@ -180,8 +182,29 @@ namespace SF::Engine
          */
         void RequestClose() { running = false; }
 
+        /**
+         * Gets the dependency graph of the running modules, built when the engine was created.
+         * @return The module graph.
+         */
+        const ModuleGraph &GetModuleGraph() const { return moduleGraph; }
+
+        /**
+         * Gets the memory counters of every module, refreshed about once a second.
+         * @return Live bytes, peak and allocation rate per module, untagged memory first.
+         */
+        std::vector<MemoryTagStats> GetMemoryReport() const { return MemoryTracker::Get().GetReport(); }
+
+        /**
+         * Writes the memory report to the log.
+         */
+        void LogMemoryReport() const;
+
     private:
-        void CreateModule(Module::RegistryMap::const_iterator it, const ModuleFilter &filter);
+        void CreateModule(TypeId id);
+        void SetupStaticDispatch();
+        bool CanDispatchStatically(Module::Stage stage, const std::vector<TypeId> &ids) const;
+        void ShutdownModules();
+        void UpdateMemoryStats();
         void DestroyModule(TypeId id);
         void UpdateStage(Module::Stage stage);
 
@@ -192,14 +215,16 @@ namespace SF::Engine
 
         std::unique_ptr<App> app;
 
+        ModuleGraph moduleGraph;
         std::map<TypeId, std::unique_ptr<Module>> modules;
         std::map<Module::Stage, std::vector<TypeId>> moduleStages;
+        std::map<Module::Stage, void (*)()> staticUpdates;
 
         float fpsLimit;
         bool running;
 
         DeltaTime deltaUpdate, deltaRender;
-        ElapsedTime elapsedUpdate, elapsedRender;
+        ElapsedTime elapsedUpdate, elapsedRender, elapsedMemory;
     };
 
 }
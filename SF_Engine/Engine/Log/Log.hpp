@@ -6,6 +6,7 @@
 #include <filesystem>
 
 #include <Math/Time/Time.hpp>
+#include <UtilityClasses/TypeInformation.hpp>
 
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
@@ -205,7 +206,7 @@ namespace SF::Engine
 
         template <typename = std::enable_if_t<!std::is_same_v<T, std::nullptr_t>>>
         Loggable()
-            : Loggable(typeid(T).name())
+            : Loggable(std::string(TypeName<T>()))
         {
         }
 
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <bitset>
 #include <unordered_map>
 #include <memory>
 #include <functional>
@@ -9,7 +8,9 @@
 #include <concepts>
 
 #include <UtilityClasses/TypeInformation.hpp>
+#include <UtilityClasses/MemoryTracking.hpp>
 #include <UtilityClasses/NoCopy.hpp>
+#include <TemplateLibrary/DynamicBitset.hpp>
 
 namespace SF::Engine
 {
@@ -38,6 +39,7 @@ namespace SF::Engine
             typename Base::Stage stage;
             std::vector<TypeId> dependencies;
             std::string_view name; // For debugging and logging
+            uint64_t typeHash = 0; // Stable across runs, unlike the registration-order TypeId
         };
 
         using RegistryMap = std::unordered_map<TypeId, CreateInfo>;
@@ -75,11 +77,18 @@ namespace SF::Engine
         template <typename T>
         class Registrar : public Base
         {
+            // RegisterModule and AutoRegister forward to Register
+            friend class ModuleFactory;
+
         public:
             virtual ~Registrar()
             {
-                if (static_cast<T *>(this) == s_instance)
+                // T is already destroyed here, so compare against the base pointer saved while it was alive
+                if (s_registrar == this)
+                {
                     s_instance = nullptr;
+                    s_registrar = nullptr;
+                }
             }
 
             static T *Get() noexcept { return s_instance; }
@@ -92,28 +101,32 @@ namespace SF::Engine
             {
                 // Optional: static_assert(std::is_base_of_v<Base, T>, "Class must derive from Module");
 
-                constexpr std::string_view moduleName = typeid(T).name();
+                constexpr std::string_view moduleName = TypeName<T>();
 
                 ModuleFactory::Registry()[TypeInfo<Base>::template GetTypeId<T>()] = {
                     []() -> std::unique_ptr<Base>
                     {
                         s_instance = new T();
+                        s_registrar = s_instance;
                         return std::unique_ptr<Base>(s_instance);
                     },
                     stage,
                     dependencies.Get(),
-                    moduleName};
+                    moduleName,
+                    TypeHash<T>()};
 
                 return true;
             }
 
         private:
             inline static T *s_instance = nullptr;
+            inline static Registrar *s_registrar = nullptr; // s_instance as a Registrar, for the destructor
         };
 
-        template <typename T, typename... Args>
+        // B delays naming Base::Stage until a call, Base is still incomplete while it derives from this class
+        template <typename T, typename... Args, typename B = Base>
         static bool RegisterModule(
-            typename Base::Stage stage,
+            typename B::Stage stage,
             Requires<Args...> deps = {})
         {
             return Registrar<T>::Register(stage, deps);
@@ -173,6 +186,22 @@ namespace SF::Engine
          */
         virtual void Shutdown() {}
 
+        /**
+         * @brief Whether Shutdown must run on the engine's thread instead of alongside the
+         * other modules of its shutdown wave (window and graphics API owners)
+         */
+        virtual bool RequiresMainThreadShutdown() const { return false; }
+
+        /**
+         * @brief Live bytes the module may hold before the engine reports it, 0 for no budget
+         */
+        virtual size_t GetMemoryBudget() const { return 0; }
+
+        /**
+         * @brief Tag the module's allocations are charged to while the engine runs its functions
+         */
+        MemoryTag GetMemoryTag() const noexcept { return memoryTag; }
+
         /**
          * @brief Get the module's update stage
          */
@@ -187,6 +216,11 @@ namespace SF::Engine
          * @brief Get the module's name (for debugging)
          */
         virtual std::string_view GetName() const = 0;
+
+    private:
+        friend class Engine;
+
+        MemoryTag memoryTag = UntaggedMemory;
     };
 
     // Explicit template instantiation
@@ -194,12 +228,13 @@ namespace SF::Engine
 
     /**
      * @brief Filter for selectively including/excluding modules
+     *
+     * Module type IDs index a growable bitset, so there is no cap on the number of modules.
+     * IDs the filter has never been told about follow the last IncludeAll()/ExcludeAll().
      */
     class ModuleFilter
     {
     public:
-        static constexpr size_t MaxModules = 128; // Increased from 64
-
         ModuleFilter()
         {
             IncludeAll();
@@ -211,8 +246,7 @@ namespace SF::Engine
         template <ModuleDerived T>
         [[nodiscard]] bool Check() const noexcept
         {
-            const auto id = TypeInfo<Module>::GetTypeId<T>();
-            return id < MaxModules && m_include.test(id);
+            return Check(TypeInfo<Module>::GetTypeId<T>());
         }
 
         /**
@@ -220,50 +254,26 @@ namespace SF::Engine
          */
         [[nodiscard]] bool Check(TypeId typeId) const noexcept
         {
-            return typeId < MaxModules && m_include.test(typeId);
+            return typeId < m_include.size() ? m_include.test(typeId) : m_includeUnlisted;
         }
 
         /**
-         * @brief Exclude a module type
-         */
-        template <ModuleDerived T>
-        ModuleFilter &Exclude() noexcept
-        {
-            const auto id = TypeInfo<Module>::GetTypeId<T>();
-            if (id < MaxModules)
-                m_include.reset(id);
-            return *this;
-        }
-
-        /**
-         * @brief Include a module type
-         */
-        template <ModuleDerived T>
-        ModuleFilter &Include() noexcept
-        {
-            const auto id = TypeInfo<Module>::GetTypeId<T>();
-            if (id < MaxModules)
-                m_include.set(id);
-            return *this;
-        }
-
-        /**
-         * @brief Exclude multiple module types
+         * @brief Exclude one or more module types
          */
         template <ModuleDerived... Args>
-        ModuleFilter &Exclude() noexcept
+        ModuleFilter &Exclude()
         {
-            (Exclude<Args>(), ...);
+            (SetIncluded(TypeInfo<Module>::GetTypeId<Args>(), false), ...);
             return *this;
         }
 
         /**
-         * @brief Include multiple module types
+         * @brief Include one or more module types
          */
         template <ModuleDerived... Args>
-        ModuleFilter &Include() noexcept
+        ModuleFilter &Include()
         {
-            (Include<Args>(), ...);
+            (SetIncluded(TypeInfo<Module>::GetTypeId<Args>(), true), ...);
             return *this;
         }
 
@@ -273,6 +283,7 @@ namespace SF::Engine
         ModuleFilter &ExcludeAll() noexcept
         {
             m_include.reset();
+            m_includeUnlisted = false;
             return *this;
         }
 
@@ -282,15 +293,20 @@ namespace SF::Engine
         ModuleFilter &IncludeAll() noexcept
         {
             m_include.set();
+            m_includeUnlisted = true;
             return *this;
         }
 
         /**
-         * @brief Get the number of included modules
+         * @brief Get the number of included modules among the registered module types
          */
         [[nodiscard]] size_t Count() const noexcept
         {
-            return m_include.count();
+            const size_t registered = TypeInfo<Module>::GetRegisteredTypeCount();
+            size_t count = m_include.count();
+            if (m_includeUnlisted && registered > m_include.size())
+                count += registered - m_include.size();
+            return count;
         }
 
         /**
@@ -298,7 +314,7 @@ namespace SF::Engine
          */
         [[nodiscard]] bool Any() const noexcept
         {
-            return m_include.any();
+            return m_includeUnlisted || m_include.any();
         }
 
         /**
@@ -306,11 +322,28 @@ namespace SF::Engine
          */
         [[nodiscard]] bool All() const noexcept
         {
-            return m_include.all();
+            return m_includeUnlisted && m_include.all();
+        }
+
+        /**
+         * @brief Get the explicit include mask, indexed by module type ID
+         */
+        [[nodiscard]] const SFTL::DynamicBitset &GetMask() const noexcept
+        {
+            return m_include;
         }
 
     private:
-        std::bitset<MaxModules> m_include;
+        void SetIncluded(TypeId id, bool included)
+        {
+            // Grow the mask to cover id, new bits taking the unlisted default
+            if (id >= m_include.size())
+                m_include.resize(id + 1, m_includeUnlisted);
+            m_include.set(id, included);
+        }
+
+        SFTL::DynamicBitset m_include;
+        bool m_includeUnlisted = true;
     };
 
 /**
@@ -0,0 +1,148 @@
+/******************************************************************************/
+/* ModuleGraph.cpp                                                            */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "ModuleGraph.hpp"
+
+#include <algorithm>
+
+namespace SF::Engine
+{
+    ModuleGraph ModuleGraph::Build(const Module::RegistryMap &registry, const ModuleFilter &filter)
+    {
+        ModuleGraph graph;
+
+        for (const auto &[id, info] : registry)
+        {
+            if (filter.Check(id))
+                graph.ids.push_back(id);
+        }
+        std::sort(graph.ids.begin(), graph.ids.end());
+
+        const size_t size = graph.ids.size();
+
+        // Forward edges, duplicates and self edges removed
+        graph.dependencyBegin.reserve(size + 1);
+        graph.dependencyBegin.push_back(0);
+        for (Node node = 0; node < size; ++node)
+        {
+            const auto first = graph.dependencies.size();
+            for (TypeId dependencyId : registry.at(graph.ids[node]).dependencies)
+            {
+                if (const auto dependency = graph.Find(dependencyId))
+                {
+                    if (*dependency != node)
+                        graph.dependencies.push_back(*dependency);
+                }
+                else if (registry.find(dependencyId) == registry.end())
+                {
+                    graph.missing.emplace_back(graph.ids[node], dependencyId);
+                }
+            }
+
+            const auto begin = graph.dependencies.begin() + first;
+            std::sort(begin, graph.dependencies.end());
+            graph.dependencies.erase(std::unique(begin, graph.dependencies.end()), graph.dependencies.end());
+            graph.dependencyBegin.push_back(static_cast<uint32_t>(graph.dependencies.size()));
+        }
+
+        // Reverse edges by counting sort, which keeps each list in ascending order
+        graph.dependentBegin.assign(size + 1, 0);
+        for (Node dependency : graph.dependencies)
+            ++graph.dependentBegin[dependency + 1];
+        for (size_t node = 0; node < size; ++node)
+            graph.dependentBegin[node + 1] += graph.dependentBegin[node];
+
+        graph.dependents.resize(graph.dependencies.size());
+        std::vector<uint32_t> cursor(graph.dependentBegin.begin(), graph.dependentBegin.end() - 1);
+        for (Node node = 0; node < size; ++node)
+        {
+            for (Node dependency : graph.GetDependencies(node))
+                graph.dependents[cursor[dependency]++] = node;
+        }
+
+        // Kahn's algorithm, one frontier per wave
+        std::vector<uint32_t> remaining(size);
+        graph.order.reserve(size);
+        for (Node node = 0; node < size; ++node)
+        {
+            remaining[node] = static_cast<uint32_t>(graph.GetDependencies(node).size());
+            if (remaining[node] == 0)
+                graph.order.push_back(node);
+        }
+
+        size_t waveStart = 0;
+        while (waveStart < graph.order.size())
+        {
+            const size_t waveEnd = graph.order.size();
+            graph.waveBegin.push_back(static_cast<uint32_t>(waveStart));
+
+            for (size_t i = waveStart; i < waveEnd; ++i)
+            {
+                for (Node dependent : graph.GetDependents(graph.order[i]))
+                {
+                    if (--remaining[dependent] == 0)
+                        graph.order.push_back(dependent);
+                }
+            }
+
+            std::sort(graph.order.begin() + waveEnd, graph.order.end());
+            waveStart = waveEnd;
+        }
+        if (!graph.order.empty())
+            graph.waveBegin.push_back(static_cast<uint32_t>(graph.order.size()));
+
+        for (Node node = 0; node < size; ++node)
+        {
+            if (remaining[node] != 0)
+                graph.cycle.push_back(node);
+        }
+
+        return graph;
+    }
+
+    std::optional<ModuleGraph::Node> ModuleGraph::Find(TypeId id) const noexcept
+    {
+        const auto it = std::lower_bound(ids.begin(), ids.end(), id);
+        if (it == ids.end() || *it != id)
+            return std::nullopt;
+        return static_cast<Node>(it - ids.begin());
+    }
+
+    size_t ModuleGraph::GetMaxWaveWidth() const noexcept
+    {
+        size_t width = 0;
+        for (size_t wave = 0; wave < GetWaveCount(); ++wave)
+            width = std::max(width, GetWave(wave).size());
+        return width;
+    }
+}
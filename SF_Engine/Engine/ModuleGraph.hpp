@@ -0,0 +1,136 @@
+/******************************************************************************/
+/* ModuleGraph.hpp                                                            */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <UtilityClasses/Export.hpp>
+
+#include "Module.hpp"
+
+namespace SF::Engine
+{
+    /**
+     * @brief Dependency graph of the modules an engine runs, built once at startup.
+     *
+     * Nodes are the registered modules that pass the filter, numbered by ascending TypeId.
+     * Edges run both ways: a node's dependencies and its dependents. Kahn's algorithm orders
+     * the nodes so every module comes after its dependencies and groups them in waves, where a
+     * wave only depends on earlier waves, so the modules of one wave can be started or shut
+     * down in parallel. Modules on a dependency cycle, and anything depending on one, are left
+     * out of the order and reported by GetCycle().
+     */
+    class SF_Export ModuleGraph
+    {
+    public:
+        using Node = uint32_t;
+
+        ModuleGraph() = default;
+
+        /**
+         * @brief Builds the graph of every module in registry that filter includes.
+         * Dependencies that are filtered out are dropped; ones that were never registered are
+         * dropped and reported by GetMissingDependencies().
+         */
+        static ModuleGraph Build(const Module::RegistryMap &registry, const ModuleFilter &filter);
+
+        size_t GetSize() const noexcept { return ids.size(); }
+        TypeId GetId(Node node) const noexcept { return ids[node]; }
+
+        /**
+         * @brief Node of a module, nullopt when it is not in the graph.
+         */
+        std::optional<Node> Find(TypeId id) const noexcept;
+
+        std::span<const Node> GetDependencies(Node node) const noexcept
+        {
+            return {dependencies.data() + dependencyBegin[node], dependencyBegin[node + 1] - dependencyBegin[node]};
+        }
+
+        std::span<const Node> GetDependents(Node node) const noexcept
+        {
+            return {dependents.data() + dependentBegin[node], dependentBegin[node + 1] - dependentBegin[node]};
+        }
+
+        /**
+         * @brief Every acyclic node, dependencies before dependents.
+         */
+        std::span<const Node> GetOrder() const noexcept { return order; }
+
+        size_t GetWaveCount() const noexcept { return waveBegin.empty() ? 0 : waveBegin.size() - 1; }
+
+        /**
+         * @brief Nodes whose dependencies all sit in earlier waves, ascending TypeId.
+         */
+        std::span<const Node> GetWave(size_t wave) const noexcept
+        {
+            return {order.data() + waveBegin[wave], waveBegin[wave + 1] - waveBegin[wave]};
+        }
+
+        /**
+         * @brief Size of the largest wave, the most modules that can ever run side by side.
+         */
+        size_t GetMaxWaveWidth() const noexcept;
+
+        bool HasCycle() const noexcept { return !cycle.empty(); }
+
+        /**
+         * @brief Nodes that could not be ordered: the cycles and everything depending on them.
+         */
+        std::span<const Node> GetCycle() const noexcept { return cycle; }
+
+        /**
+         * @brief (module, dependency) pairs whose dependency was never registered.
+         */
+        std::span<const std::pair<TypeId, TypeId>> GetMissingDependencies() const noexcept { return missing; }
+
+    private:
+        std::vector<TypeId> ids;
+
+        // Compressed adjacency: the edges of node n are [begin[n], begin[n + 1])
+        std::vector<uint32_t> dependencyBegin;
+        std::vector<Node> dependencies;
+        std::vector<uint32_t> dependentBegin;
+        std::vector<Node> dependents;
+
+        std::vector<Node> order;
+        std::vector<uint32_t> waveBegin;
+        std::vector<Node> cycle;
+        std::vector<std::pair<TypeId, TypeId>> missing;
+    };
+}
@@ -0,0 +1,150 @@
+/******************************************************************************/
+/* StaticModules.hpp                                                          */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <concepts>
+#include <map>
+#include <vector>
+
+#include "Module.hpp"
+
+// Opt-in compile-time module dispatch. Builds whose module set is fixed (dedicated servers)
+// can list their modules per stage; the engine then updates them through one generated
+// function per stage that calls each Update directly, so the calls can be inlined instead of
+// going through the vtable. Listed modules are still registered, created, initialized and shut
+// down as usual, only their per-frame update changes.
+//
+//     using ServerModules = StaticModuleList<
+//         StaticStage<Module::Stage::Pre, Network>,
+//         StaticStage<Module::Stage::Normal, Simulation, Ai>>;
+//     inline const AutoRegisterStatic<ServerModules> serverModules;
+//
+// Within a stage the listed modules run first, in list order, before the stage's other modules.
+// The engine checks at startup that this order agrees with the module dependencies and falls
+// back to virtual dispatch for the stage, with an error in the log, when it does not.
+namespace SF::Engine
+{
+    /**
+     * @brief Generated update of one stage and the modules it calls, in call order.
+     */
+    struct StaticStageDispatch
+    {
+        void (*update)() = nullptr;
+        std::vector<TypeId> modules;
+    };
+
+    /**
+     * @brief Stage dispatchers registered through AutoRegisterStatic, read when the engine starts.
+     */
+    inline std::map<Module::Stage, StaticStageDispatch> &StaticDispatchRegistry()
+    {
+        static std::map<Module::Stage, StaticStageDispatch> impl;
+        return impl;
+    }
+
+    /**
+     * @brief A module whose single instance is reachable statically, as Registrar provides.
+     */
+    template <typename T>
+    concept StaticModule = ModuleDerived<T> && requires {
+        { T::Get() } -> std::convertible_to<T *>;
+    };
+
+    /**
+     * @brief The modules updated by direct calls in one stage.
+     */
+    template <Module::Stage S, StaticModule... Modules>
+    struct StaticStage
+    {
+        static constexpr Module::Stage stage = S;
+
+        static void Update()
+        {
+            // Qualified calls bind to Modules::Update at compile time; filtered out modules have no instance
+            (
+                [] {
+                    if (Modules *module = Modules::Get())
+                    {
+                        MemoryScope scope(module->GetMemoryTag());
+                        module->Modules::Update();
+                    }
+                }(),
+                ...);
+        }
+
+        static std::vector<TypeId> GetIds() { return {TypeInfo<Module>::GetTypeId<Modules>()...}; }
+    };
+
+    /**
+     * @brief Typelist of StaticStage, at most one per stage.
+     */
+    template <typename... Stages>
+    struct StaticModuleList
+    {
+        static_assert(sizeof...(Stages) > 0, "StaticModuleList needs at least one StaticStage");
+
+        static constexpr bool HasUniqueStages()
+        {
+            constexpr Module::Stage stages[] = {Stages::stage...};
+            for (size_t i = 0; i < sizeof...(Stages); ++i)
+            {
+                for (size_t j = i + 1; j < sizeof...(Stages); ++j)
+                {
+                    if (stages[i] == stages[j])
+                        return false;
+                }
+            }
+            return true;
+        }
+        static_assert(HasUniqueStages(), "Each stage can appear once in a StaticModuleList");
+
+        static bool Register()
+        {
+            ((StaticDispatchRegistry()[Stages::stage] = {&Stages::Update, Stages::GetIds()}), ...);
+            return true;
+        }
+    };
+
+    /**
+     * @brief Registers a StaticModuleList when constructed, the list counterpart of AutoRegister.
+     */
+    template <typename List>
+    struct AutoRegisterStatic
+    {
+        AutoRegisterStatic()
+        {
+            List::Register();
+        }
+    };
+}
@@ -1,5 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+
+#include <Reflection/Reflection.hpp>
+
 #define ModuleEntryPoint void ModuleInit()
 
-#define ExportClass(...)
-#define NoExport(...) // Define members inside an FClass() as not exportable.
-#define _API_MODULE_MAIN()
\ No newline at end of file
+// offsetof on a class that is not standard-layout is conditionally supported; GCC, Clang and
+// MSVC all give the right answer as long as there are no virtual bases
+#if defined(__GNUC__) || defined(__clang__)
+#define SF_REFLECT_OFFSETOF_BEGIN _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Winvalid-offsetof\"")
+#define SF_REFLECT_OFFSETOF_END _Pragma("GCC diagnostic pop")
+#else
+#define SF_REFLECT_OFFSETOF_BEGIN
+#define SF_REFLECT_OFFSETOF_END
+#endif
+
+/**
+ * @brief Exports the listed fields of a class to the reflection layer (Reflection/Reflection.hpp).
+ * Usage, anywhere inside the class body:
+ *     ExportClass(Player, ExportField(health), ExportField(cachedPath, FieldFlags::Transient))
+ */
+#define ExportClass(Class, ...)                      \
+    using SFReflectedClass = Class;                  \
+    friend struct ::SF::Engine::Reflection::Access;  \
+    SF_REFLECT_OFFSETOF_BEGIN                        \
+    static constexpr auto SFReflectFields() noexcept \
+    {                                                \
+        using namespace ::SF::Engine::Reflection;    \
+        return std::make_tuple(__VA_ARGS__);         \
+    }                                                \
+    SF_REFLECT_OFFSETOF_END
+
+/**
+ * @brief One field of an ExportClass list, optionally followed by FieldFlags.
+ */
+#define ExportField(Member, ...)                                                                        \
+    ::SF::Engine::Reflection::MakeField(#Member, &SFReflectedClass::Member,                              \
+                                        offsetof(SFReflectedClass, Member), ##__VA_ARGS__)
+
+#define NoExport(...) __VA_ARGS__ // Marks members of an ExportClass() class as deliberately not exported.
+#define _API_MODULE_MAIN()
@@ -0,0 +1,217 @@
+/******************************************************************************/
+/* Reflection.hpp                                                             */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <UtilityClasses/TypeInformation.hpp>
+
+namespace SF::Engine::Reflection
+{
+    /**
+     * @brief Per-field annotations passed as the optional second argument of ExportField.
+     */
+    enum class FieldFlags : uint32_t
+    {
+        None = 0,
+        Transient = 1 << 0, // Not serialized or replicated
+        ReadOnly = 1 << 1,  // Shown but not editable in inspectors
+        Hidden = 1 << 2     // Not shown in inspectors
+    };
+
+    constexpr FieldFlags operator|(FieldFlags a, FieldFlags b) noexcept
+    {
+        return static_cast<FieldFlags>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+    }
+
+    constexpr bool HasFlag(FieldFlags flags, FieldFlags flag) noexcept
+    {
+        return (static_cast<uint32_t>(flags) & static_cast<uint32_t>(flag)) != 0;
+    }
+
+    /**
+     * @brief Compile-time description of one exported data member.
+     */
+    template <typename Class, typename Member>
+    struct FieldInfo
+    {
+        using ClassType = Class;
+        using Type = Member;
+
+        std::string_view name;
+        std::string_view typeName;
+        Member Class::*pointer;
+        size_t offset; // Byte offset, valid for any class without virtual bases
+        FieldFlags flags;
+
+        constexpr Member &Get(Class &object) const noexcept { return object.*pointer; }
+        constexpr const Member &Get(const Class &object) const noexcept { return object.*pointer; }
+
+        constexpr bool Has(FieldFlags flag) const noexcept { return HasFlag(flags, flag); }
+    };
+
+    /**
+     * @brief Called by ExportField, builds the FieldInfo for one member.
+     */
+    template <typename Class, typename Member>
+    constexpr FieldInfo<Class, Member> MakeField(std::string_view name, Member Class::*pointer, size_t offset, FieldFlags flags = FieldFlags::None) noexcept
+    {
+        return {name, TypeName<Member>(), pointer, offset, flags};
+    }
+
+    /**
+     * @brief Reaches the private field list ExportClass generates.
+     */
+    struct Access
+    {
+        template <typename T>
+        static constexpr auto Fields() noexcept -> decltype(T::SFReflectFields())
+        {
+            return T::SFReflectFields();
+        }
+    };
+
+    /**
+     * @brief True for classes annotated with ExportClass.
+     */
+    template <typename T>
+    concept Reflected = requires { Access::Fields<T>(); };
+
+    template <typename T>
+    inline constexpr bool IsReflected = Reflected<T>;
+
+    /**
+     * @brief Tuple of FieldInfo for every exported field of T, in declaration order of the ExportClass list.
+     */
+    template <Reflected T>
+    inline constexpr auto Fields = Access::Fields<T>();
+
+    template <Reflected T>
+    inline constexpr size_t FieldCount = std::tuple_size_v<std::remove_const_t<decltype(Fields<T>)>>;
+
+    /**
+     * @brief Calls func(field) for every field of T, field being a FieldInfo.
+     */
+    template <Reflected T, typename Func>
+    constexpr void ForEachField(Func &&func)
+    {
+        std::apply([&](const auto &...fields)
+                   { (func(fields), ...); },
+                   Fields<T>);
+    }
+
+    /**
+     * @brief Calls func(field, value) for every field of object, value being a reference to the member.
+     */
+    template <typename T, typename Func>
+        requires Reflected<std::remove_const_t<T>>
+    constexpr void ForEachField(T &object, Func &&func)
+    {
+        std::apply([&](const auto &...fields)
+                   { (func(fields, object.*fields.pointer), ...); },
+                   Fields<std::remove_const_t<T>>);
+    }
+
+    /**
+     * @brief Index of the field called name, FieldCount<T> when there is none.
+     */
+    template <Reflected T>
+    constexpr size_t FieldIndex(std::string_view name) noexcept
+    {
+        size_t index = FieldCount<T>;
+        size_t current = 0;
+        ForEachField<T>([&](const auto &field)
+                        {
+                            if (index == FieldCount<T> && field.name == name)
+                                index = current;
+                            ++current; });
+        return index;
+    }
+
+    namespace detail
+    {
+        template <typename T>
+        constexpr bool IsTriviallySerializableField() noexcept;
+
+        template <typename T>
+        constexpr bool ComputeTriviallySerializable() noexcept
+        {
+            if constexpr (!Reflected<T> || !std::is_trivially_copyable_v<T>)
+            {
+                return false;
+            }
+            else
+            {
+                bool serializable = true;
+                size_t coveredBytes = 0;
+                ForEachField<T>([&](const auto &field)
+                                {
+                                    using Member = typename std::remove_cvref_t<decltype(field)>::Type;
+                                    serializable = serializable && !HasFlag(field.flags, FieldFlags::Transient) &&
+                                                   IsTriviallySerializableField<Member>();
+                                    coveredBytes += sizeof(Member); });
+
+                // Every byte belongs to an exported field: no padding, no unexported state
+                return serializable && coveredBytes == sizeof(T);
+            }
+        }
+
+        template <typename T>
+        constexpr bool IsTriviallySerializableField() noexcept
+        {
+            if constexpr (std::is_array_v<T>)
+                return IsTriviallySerializableField<std::remove_extent_t<T>>();
+            else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+                return !std::is_same_v<T, bool>; // Any byte other than 0/1 would be an invalid bool
+            else
+                return ComputeTriviallySerializable<T>();
+        }
+    }
+
+    /**
+     * @brief True when a T can be saved and loaded with a plain memcpy.
+     *
+     * T must be reflected and trivially copyable, and its exported fields must be arithmetic,
+     * enums, arrays of those or other trivially serializable classes, with none marked
+     * Transient and together covering every byte of T (so there is no padding and nothing
+     * unexported, pointers included).
+     */
+    template <typename T>
+    inline constexpr bool IsTriviallySerializable = detail::ComputeTriviallySerializable<T>();
+}
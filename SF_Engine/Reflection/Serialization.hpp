@@ -0,0 +1,744 @@
+/******************************************************************************/
+/* Serialization.hpp                                                          */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <Reflection/Reflection.hpp>
+#include <TemplateLibrary/Dynamic.hpp>
+#include <UtilityClasses/ConstantExpression.hpp>
+
+// Zero-copy binary serialization of reflected types.
+//
+// Serialize writes a value as one flat, aligned image: a BinaryHeader followed by the root
+// record. Every record is a fixed-size block of field slots; strings and arrays live out of
+// line and are referenced by OffsetArray, a relative pointer, so the image has no absolute
+// addresses and can be memory-mapped and read in place through FlatView. Trivially
+// serializable records and arrays of them are single memcpys in both directions.
+//
+// Field slots by member type:
+//     arithmetic, enum, trivially serializable class, C array of those   raw bytes of the member
+//     bool                                                                one byte, 0 or 1
+//     std::string                                                         OffsetArray of chars
+//     std::vector<U>, SFTL::DynamicArray<U>                               OffsetArray of U slots
+//     other reflected class                                               its record, inline
+// Transient fields take no slot. The image is little-endian only; a byte-swapped magic makes
+// Read fail rather than return garbage.
+namespace SF::Engine::Reflection
+{
+    /**
+     * @brief Relative pointer to count elements of T stored in the same image.
+     */
+    template <typename T = std::byte>
+    struct OffsetArray
+    {
+        int64_t offset; // From the address of this OffsetArray to the first element
+        uint64_t count;
+
+        const T *data() const noexcept { return reinterpret_cast<const T *>(reinterpret_cast<const std::byte *>(this) + offset); }
+        size_t size() const noexcept { return static_cast<size_t>(count); }
+        bool empty() const noexcept { return count == 0; }
+
+        const T &operator[](size_t index) const noexcept { return data()[index]; }
+        const T *begin() const noexcept { return data(); }
+        const T *end() const noexcept { return data() + count; }
+    };
+
+    /**
+     * @brief First bytes of every serialized image.
+     */
+    struct BinaryHeader
+    {
+        static constexpr uint32_t Magic = 0x4E424653; // "SFBN"
+        static constexpr uint16_t FormatVersion = 1;
+
+        uint32_t magic;
+        uint16_t formatVersion; // Slot layout rules, bumped when this file changes them
+        uint16_t alignment;     // Alignment the image must be loaded at
+        uint64_t schemaHash;    // SchemaHash of the root type
+        uint64_t rootOffset;
+        uint64_t size; // Whole image, header included
+    };
+
+    /**
+     * @brief Images must start at this alignment; heap buffers and mapped pages both satisfy it.
+     */
+    inline constexpr size_t BinaryAlignment = 16;
+
+    template <typename T>
+    class FlatView;
+
+    template <typename T>
+    class FlatArrayView;
+
+    namespace detail
+    {
+        enum class SlotKind
+        {
+            Pod,
+            Bool,
+            String,
+            Array,
+            Record,
+            Unsupported
+        };
+
+        template <typename T>
+        struct SequenceTraits
+        {
+            static constexpr bool value = false;
+        };
+
+        template <typename U, typename A>
+        struct SequenceTraits<std::vector<U, A>>
+        {
+            static constexpr bool value = true;
+            using Element = U;
+        };
+
+        template <typename U, typename A>
+        struct SequenceTraits<SFTL::DynamicArray<U, A>>
+        {
+            static constexpr bool value = true;
+            using Element = U;
+        };
+
+        template <typename T>
+        struct IsStdString : std::false_type
+        {
+        };
+
+        template <typename Traits, typename A>
+        struct IsStdString<std::basic_string<char, Traits, A>> : std::true_type
+        {
+        };
+
+        template <typename M>
+        constexpr SlotKind KindOf() noexcept
+        {
+            if constexpr (std::is_same_v<M, bool>)
+                return SlotKind::Bool;
+            else if constexpr (IsTriviallySerializableField<M>())
+                return SlotKind::Pod;
+            else if constexpr (IsStdString<M>::value)
+                return SlotKind::String;
+            else if constexpr (SequenceTraits<M>::value)
+                return SlotKind::Array;
+            else if constexpr (Reflected<M>)
+                return SlotKind::Record;
+            else
+                return SlotKind::Unsupported;
+        }
+
+        template <typename M>
+        inline constexpr SlotKind Kind = KindOf<M>();
+
+        constexpr size_t AlignUp(size_t value, size_t alignment) noexcept
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        template <typename T>
+        struct FlatLayout;
+
+        template <typename M>
+        constexpr size_t SlotSize() noexcept
+        {
+            static_assert(Kind<M> != SlotKind::Unsupported, "Member type cannot be serialized");
+            if constexpr (Kind<M> == SlotKind::Pod)
+                return sizeof(M);
+            else if constexpr (Kind<M> == SlotKind::Bool)
+                return 1;
+            else if constexpr (Kind<M> == SlotKind::String || Kind<M> == SlotKind::Array)
+                return sizeof(OffsetArray<>);
+            else
+                return FlatLayout<M>::size;
+        }
+
+        template <typename M>
+        constexpr size_t SlotAlign() noexcept
+        {
+            if constexpr (Kind<M> == SlotKind::Pod)
+            {
+                static_assert(alignof(M) <= BinaryAlignment, "Over-aligned members cannot be read in place");
+                return alignof(M);
+            }
+            else if constexpr (Kind<M> == SlotKind::Bool)
+                return 1;
+            else if constexpr (Kind<M> == SlotKind::String || Kind<M> == SlotKind::Array)
+                return alignof(OffsetArray<>);
+            else
+                return FlatLayout<M>::align;
+        }
+
+        inline constexpr size_t NoSlot = ~size_t(0);
+
+        /**
+         * @brief Slot offsets of a record. Trivially serializable classes keep their in-memory
+         * layout so they can be copied whole, anything else packs its slots in field order.
+         */
+        template <typename T>
+        struct FlatLayout
+        {
+            struct Result
+            {
+                std::array<size_t, FieldCount<T>> offsets{};
+                size_t size = 0;
+                size_t align = 1;
+            };
+
+            static constexpr Result Compute() noexcept
+            {
+                Result result;
+                if constexpr (IsTriviallySerializable<T>)
+                {
+                    size_t index = 0;
+                    ForEachField<T>([&](const auto &field)
+                                    { result.offsets[index++] = field.offset; });
+                    result.size = sizeof(T);
+                    result.align = alignof(T);
+                }
+                else
+                {
+                    size_t index = 0;
+                    size_t cursor = 0;
+                    ForEachField<T>([&](const auto &field)
+                                    {
+                                        using Member = typename std::remove_cvref_t<decltype(field)>::Type;
+                                        if (field.Has(FieldFlags::Transient))
+                                        {
+                                            result.offsets[index++] = NoSlot;
+                                            return;
+                                        }
+                                        cursor = AlignUp(cursor, SlotAlign<Member>());
+                                        result.offsets[index++] = cursor;
+                                        cursor += SlotSize<Member>();
+                                        result.align = SlotAlign<Member>() > result.align ? SlotAlign<Member>() : result.align; });
+                    result.size = AlignUp(cursor, result.align);
+                }
+                return result;
+            }
+
+            static constexpr Result layout = Compute();
+            static constexpr size_t size = layout.size;
+            static constexpr size_t align = layout.align;
+
+            static constexpr size_t Offset(size_t fieldIndex) noexcept { return layout.offsets[fieldIndex]; }
+        };
+
+        constexpr uint64_t HashValue(uint64_t hash, uint64_t value) noexcept
+        {
+            for (int i = 0; i < 8; ++i)
+            {
+                hash ^= (value >> (i * 8)) & 0xFF;
+                hash *= ::SF::Engine::detail::fnv1a_prime;
+            }
+            return hash;
+        }
+
+        // Hashes what the bytes of a slot mean, never compiler-specific type spellings, so
+        // images written by one toolchain load on another
+        template <typename M>
+        constexpr uint64_t SlotHash(uint64_t hash) noexcept
+        {
+            if constexpr (std::is_array_v<M>)
+                return SlotHash<std::remove_extent_t<M>>(HashValue(hash_fnv1a("[", hash), std::extent_v<M>));
+            else if constexpr (std::is_enum_v<M>)
+                return SlotHash<std::underlying_type_t<M>>(hash_fnv1a("e", hash));
+            else if constexpr (std::is_same_v<M, bool>)
+                return hash_fnv1a("b", hash);
+            else if constexpr (std::is_floating_point_v<M>)
+                return HashValue(hash_fnv1a("f", hash), sizeof(M));
+            else if constexpr (std::is_integral_v<M>)
+                return HashValue(hash_fnv1a(std::is_signed_v<M> ? "i" : "u", hash), sizeof(M));
+            else if constexpr (Kind<M> == SlotKind::String)
+                return hash_fnv1a("s", hash);
+            else if constexpr (Kind<M> == SlotKind::Array)
+                return SlotHash<typename SequenceTraits<M>::Element>(hash_fnv1a("v", hash));
+            else
+            {
+                static_assert(Reflected<M>, "Member type cannot be serialized");
+                hash = hash_fnv1a("{", hash);
+                size_t index = 0;
+                ForEachField<M>([&](const auto &field)
+                                {
+                                    using Member = typename std::remove_cvref_t<decltype(field)>::Type;
+                                    const size_t offset = FlatLayout<M>::Offset(index++);
+                                    if (offset == NoSlot)
+                                        return;
+                                    hash = HashValue(hash_fnv1a(field.name, hash), offset);
+                                    hash = SlotHash<Member>(hash); });
+                return HashValue(hash_fnv1a("}", hash), FlatLayout<M>::size);
+            }
+        }
+
+        // Lays out an image. Run once with Emit false to size the buffer, then again with Emit
+        // true to fill it; both passes allocate in the same order so the offsets agree.
+        template <bool Emit>
+        struct ImageWriter
+        {
+            std::byte *base = nullptr;
+            size_t cursor = 0;
+
+            size_t Allocate(size_t size, size_t alignment) noexcept
+            {
+                const size_t at = AlignUp(cursor, alignment);
+                cursor = at + size;
+                return at;
+            }
+
+            void Copy(size_t at, const void *source, size_t size) noexcept
+            {
+                if constexpr (Emit)
+                {
+                    if (size != 0)
+                        std::memcpy(base + at, source, size);
+                }
+            }
+
+            void Link(size_t slot, size_t target, size_t count) noexcept
+            {
+                if constexpr (Emit)
+                {
+                    const OffsetArray<> link{static_cast<int64_t>(target) - static_cast<int64_t>(slot), count};
+                    std::memcpy(base + slot, &link, sizeof(link));
+                }
+            }
+
+            template <typename M>
+            void WriteSlot(size_t at, const M &value)
+            {
+                if constexpr (Kind<M> == SlotKind::Pod)
+                {
+                    Copy(at, &value, sizeof(M));
+                }
+                else if constexpr (Kind<M> == SlotKind::Bool)
+                {
+                    const std::byte byte{value ? uint8_t(1) : uint8_t(0)};
+                    Copy(at, &byte, 1);
+                }
+                else if constexpr (Kind<M> == SlotKind::String)
+                {
+                    const size_t block = Allocate(value.size(), 1);
+                    Copy(block, value.data(), value.size());
+                    Link(at, block, value.size());
+                }
+                else if constexpr (Kind<M> == SlotKind::Array)
+                {
+                    using Element = typename SequenceTraits<M>::Element;
+                    constexpr size_t stride = SlotSize<Element>();
+                    const size_t count = value.size();
+                    // Elements without slots still get a byte each, so Read can bound the count by the image size
+                    const size_t block = Allocate(count * (stride != 0 ? stride : 1), SlotAlign<Element>());
+                    Link(at, block, count);
+
+                    if constexpr (Kind<Element> == SlotKind::Pod)
+                    {
+                        Copy(block, value.data(), count * stride); // Bulk copy, no per-element work
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                            WriteSlot<Element>(block + i * stride, value[i]);
+                    }
+                }
+                else
+                {
+                    WriteRecord(at, value);
+                }
+            }
+
+            template <typename T>
+            void WriteRecord(size_t at, const T &value)
+            {
+                size_t index = 0;
+                ForEachField(value, [&](const auto &field, const auto &member)
+                             {
+                                 using Member = typename std::remove_cvref_t<decltype(field)>::Type;
+                                 const size_t offset = FlatLayout<T>::Offset(index++);
+                                 if (offset != NoSlot)
+                                     WriteSlot<Member>(at + offset, member); });
+            }
+        };
+
+        // Checks every OffsetArray reachable from a slot. Blocks always follow the slot that
+        // links them, which also rules out cycles in a crafted image.
+        template <typename M>
+        bool ValidateSlot(const std::byte *base, size_t size, size_t at) noexcept
+        {
+            if constexpr (Kind<M> == SlotKind::String || Kind<M> == SlotKind::Array)
+            {
+                OffsetArray<> link;
+                std::memcpy(&link, base + at, sizeof(link));
+
+                size_t stride = 1;
+                size_t alignment = 1;
+                if constexpr (Kind<M> == SlotKind::Array)
+                {
+                    using Element = typename SequenceTraits<M>::Element;
+                    stride = SlotSize<Element>();
+                    alignment = SlotAlign<Element>();
+                }
+
+                if (link.offset < static_cast<int64_t>(sizeof(link)) || static_cast<uint64_t>(link.offset) > size - at)
+                    return false;
+
+                // A zero stride still takes one byte per element (see WriteSlot), which keeps a crafted
+                // count from making Deserialize resize to an arbitrary length
+                const size_t block = at + static_cast<size_t>(link.offset);
+                if (block % alignment != 0 || link.count > (size - block) / (stride != 0 ? stride : 1))
+                    return false;
+
+                if constexpr (Kind<M> == SlotKind::Array)
+                {
+                    using Element = typename SequenceTraits<M>::Element;
+                    if constexpr (Kind<Element> != SlotKind::Pod && Kind<Element> != SlotKind::Bool)
+                    {
+                        for (size_t i = 0; i < link.count; ++i)
+                        {
+                            if (!ValidateSlot<Element>(base, size, block + i * stride))
+                                return false;
+                        }
+                    }
+                }
+                return true;
+            }
+            else if constexpr (Kind<M> == SlotKind::Record)
+            {
+                bool valid = true;
+                size_t index = 0;
+                ForEachField<M>([&](const auto &field)
+                                {
+                                    using Member = typename std::remove_cvref_t<decltype(field)>::Type;
+                                    const size_t offset = FlatLayout<M>::Offset(index++);
+                                    if (valid && offset != NoSlot)
+                                        valid = ValidateSlot<Member>(base, size, at + offset); });
+                return valid;
+            }
+            else
+            {
+                return true;
+            }
+        }
+
+        template <typename M>
+        decltype(auto) ReadSlot(const std::byte *slot) noexcept
+        {
+            if constexpr (Kind<M> == SlotKind::Pod)
+            {
+                return *reinterpret_cast<const M *>(slot);
+            }
+            else if constexpr (Kind<M> == SlotKind::Bool)
+            {
+                return *slot != std::byte{0};
+            }
+            else if constexpr (Kind<M> == SlotKind::String)
+            {
+                const auto &link = *reinterpret_cast<const OffsetArray<char> *>(slot);
+                return std::string_view(link.data(), link.size());
+            }
+            else if constexpr (Kind<M> == SlotKind::Array)
+            {
+                using Element = typename SequenceTraits<M>::Element;
+                if constexpr (Kind<Element> == SlotKind::Pod)
+                {
+                    const auto &link = *reinterpret_cast<const OffsetArray<Element> *>(slot);
+                    return std::span<const Element>(link.data(), link.size());
+                }
+                else
+                {
+                    const auto &link = *reinterpret_cast<const OffsetArray<> *>(slot);
+                    return FlatArrayView<Element>(link.data(), link.size());
+                }
+            }
+            else
+            {
+                return FlatView<M>(slot);
+            }
+        }
+
+        template <typename M>
+        void LoadSlot(const std::byte *slot, M &out)
+        {
+            if constexpr (Kind<M> == SlotKind::Pod)
+            {
+                std::memcpy(&out, slot, sizeof(M));
+            }
+            else if constexpr (Kind<M> == SlotKind::Bool)
+            {
+                out = *slot != std::byte{0};
+            }
+            else if constexpr (Kind<M> == SlotKind::String)
+            {
+                const auto &link = *reinterpret_cast<const OffsetArray<char> *>(slot);
+                out.assign(link.data(), link.size());
+            }
+            else if constexpr (Kind<M> == SlotKind::Array)
+            {
+                using Element = typename SequenceTraits<M>::Element;
+                constexpr size_t stride = SlotSize<Element>();
+                const auto &link = *reinterpret_cast<const OffsetArray<> *>(slot);
+
+                out.clear();
+                out.resize(link.size());
+                if constexpr (Kind<Element> == SlotKind::Pod)
+                {
+                    if (!link.empty())
+                        std::memcpy(out.data(), link.data(), link.size() * stride);
+                }
+                else if constexpr (Kind<Element> == SlotKind::Bool)
+                {
+                    for (size_t i = 0; i < link.size(); ++i)
+                        out[i] = link[i] != std::byte{0}; // Also right for std::vector<bool>
+                }
+                else
+                {
+                    for (size_t i = 0; i < link.size(); ++i)
+                        LoadSlot<Element>(link.data() + i * stride, out[i]);
+                }
+            }
+            else if constexpr (IsTriviallySerializable<M>)
+            {
+                std::memcpy(&out, slot, sizeof(M));
+            }
+            else
+            {
+                size_t index = 0;
+                ForEachField(out, [&](const auto &field, auto &member)
+                             {
+                                 using Member = typename std::remove_cvref_t<decltype(field)>::Type;
+                                 const size_t offset = FlatLayout<M>::Offset(index++);
+                                 if (offset != NoSlot)
+                                     LoadSlot<Member>(slot + offset, member); });
+            }
+        }
+    }
+
+    /**
+     * @brief Hash of the image layout of T: field names, slot offsets and slot types, nested
+     * types included. Images are only read back as a type with the same hash.
+     */
+    template <Reflected T>
+    inline constexpr uint64_t SchemaHash = detail::SlotHash<T>(detail::HashValue(::SF::Engine::detail::fnv1a_offset, BinaryHeader::FormatVersion));
+
+    /**
+     * @brief In-place view of a serialized T, valid as long as the image is.
+     *
+     * Get returns the member by const reference for raw slots, bool, std::string_view for
+     * strings, std::span for arrays of raw elements, FlatArrayView for other arrays and
+     * FlatView for nested records.
+     */
+    template <typename T>
+    class FlatView
+    {
+    public:
+        explicit FlatView(const std::byte *record) noexcept : record_(record) {}
+
+        template <size_t Index>
+        decltype(auto) Get() const noexcept
+        {
+            constexpr size_t offset = detail::FlatLayout<T>::Offset(Index);
+            static_assert(offset != detail::NoSlot, "Transient fields are not serialized");
+            using Member = typename std::tuple_element_t<Index, std::remove_const_t<decltype(Fields<T>)>>::Type;
+            return detail::ReadSlot<Member>(record_ + offset);
+        }
+
+        template <::SF::Engine::detail::fixed_string Name>
+        decltype(auto) Get() const noexcept
+        {
+            constexpr size_t index = FieldIndex<T>(Name.view());
+            static_assert(index < FieldCount<T>, "No exported field with this name");
+            return Get<index>();
+        }
+
+        /**
+         * @brief Copies the record out into a live object; transient fields are left untouched.
+         */
+        void Load(T &out) const { detail::LoadSlot<T>(record_, out); }
+
+        const std::byte *Data() const noexcept { return record_; }
+
+    private:
+        const std::byte *record_;
+    };
+
+    /**
+     * @brief In-place view of a serialized array whose elements are not raw bytes.
+     */
+    template <typename T>
+    class FlatArrayView
+    {
+    public:
+        static constexpr size_t Stride = detail::SlotSize<T>();
+
+        FlatArrayView(const std::byte *data, size_t count) noexcept : data_(data), count_(count) {}
+
+        size_t size() const noexcept { return count_; }
+        bool empty() const noexcept { return count_ == 0; }
+
+        decltype(auto) operator[](size_t index) const noexcept { return detail::ReadSlot<T>(data_ + index * Stride); }
+
+        class Iterator
+        {
+        public:
+            Iterator(const std::byte *slot) noexcept : slot_(slot) {}
+
+            decltype(auto) operator*() const noexcept { return detail::ReadSlot<T>(slot_); }
+            Iterator &operator++() noexcept
+            {
+                slot_ += Stride;
+                return *this;
+            }
+            bool operator==(const Iterator &other) const noexcept = default;
+
+        private:
+            const std::byte *slot_;
+        };
+
+        Iterator begin() const noexcept { return Iterator(data_); }
+        Iterator end() const noexcept { return Iterator(data_ + count_ * Stride); }
+
+    private:
+        const std::byte *data_;
+        size_t count_;
+    };
+
+    /**
+     * @brief Appends the image of value to out, which is cleared first so it can be reused.
+     */
+    template <Reflected T>
+    void Serialize(const T &value, SFTL::DynamicArray<std::byte> &out)
+    {
+        constexpr size_t rootOffset = detail::AlignUp(sizeof(BinaryHeader), detail::FlatLayout<T>::align);
+
+        detail::ImageWriter<false> sizing;
+        sizing.cursor = rootOffset + detail::FlatLayout<T>::size;
+        sizing.WriteRecord(rootOffset, value);
+
+        out.clear();
+        out.resize(sizing.cursor); // Zero filled, padding never leaks stale memory
+
+        detail::ImageWriter<true> writer;
+        writer.base = out.data();
+        writer.cursor = rootOffset + detail::FlatLayout<T>::size;
+        writer.WriteRecord(rootOffset, value);
+
+        const BinaryHeader header{BinaryHeader::Magic, BinaryHeader::FormatVersion, static_cast<uint16_t>(BinaryAlignment),
+                                  SchemaHash<T>, rootOffset, sizing.cursor};
+        std::memcpy(out.data(), &header, sizeof(header));
+    }
+
+    template <Reflected T>
+    SFTL::DynamicArray<std::byte> Serialize(const T &value)
+    {
+        SFTL::DynamicArray<std::byte> image;
+        Serialize(value, image);
+        return image;
+    }
+
+    /**
+     * @brief Header of an image, nullptr when data is too short or not an image of this format.
+     * Lets a loader pick which version of a type to read by its schemaHash.
+     */
+    inline const BinaryHeader *ReadHeader(std::span<const std::byte> data) noexcept
+    {
+        if (data.size() < sizeof(BinaryHeader) || reinterpret_cast<uintptr_t>(data.data()) % BinaryAlignment != 0)
+            return nullptr;
+
+        const auto *header = reinterpret_cast<const BinaryHeader *>(data.data());
+        if (header->magic != BinaryHeader::Magic || header->formatVersion != BinaryHeader::FormatVersion ||
+            header->size > data.size())
+            return nullptr;
+        return header;
+    }
+
+    /**
+     * @brief Maps an image as a T without checking its OffsetArrays. Only for trusted data,
+     * such as level files shipped with the game; use Read for anything else.
+     */
+    template <Reflected T>
+    std::optional<FlatView<T>> ReadUnchecked(std::span<const std::byte> data) noexcept
+    {
+        const BinaryHeader *header = ReadHeader(data);
+        if (!header || header->schemaHash != SchemaHash<T> || header->rootOffset % detail::FlatLayout<T>::align != 0 ||
+            header->rootOffset < sizeof(BinaryHeader) || header->rootOffset > header->size ||
+            header->size - header->rootOffset < detail::FlatLayout<T>::size)
+            return std::nullopt;
+        return FlatView<T>(data.data() + header->rootOffset);
+    }
+
+    /**
+     * @brief Maps an image as a T, nullopt when the schema differs or the image is malformed.
+     */
+    template <Reflected T>
+    std::optional<FlatView<T>> Read(std::span<const std::byte> data) noexcept
+    {
+        std::optional<FlatView<T>> view = ReadUnchecked<T>(data);
+        if (view && !detail::ValidateSlot<T>(data.data(), reinterpret_cast<const BinaryHeader *>(data.data())->size,
+                                             static_cast<size_t>(view->Data() - data.data())))
+            return std::nullopt;
+        return view;
+    }
+
+    /**
+     * @brief Reads an image back into a live object, false when Read would fail.
+     */
+    template <Reflected T>
+    bool Deserialize(std::span<const std::byte> data, T &out)
+    {
+        const std::optional<FlatView<T>> view = Read<T>(data);
+        if (!view)
+            return false;
+        view->Load(out);
+        return true;
+    }
+
+    template <Reflected T>
+    std::optional<T> Deserialize(std::span<const std::byte> data)
+    {
+        std::optional<T> value(std::in_place);
+        if (!Deserialize(data, *value))
+            return std::nullopt;
+        return value;
+    }
+}
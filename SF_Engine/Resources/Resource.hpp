@@ -1,8 +1,7 @@
 #pragma once
 
-#include <typeindex>
-
 #include <UtilityClasses/NoCopy.hpp>
+#include <UtilityClasses/TypeInformation.hpp>
 
 namespace SF::Engine
 {
@@ -15,6 +14,10 @@ namespace SF::Engine
         Resource() = default;
         virtual ~Resource() = default;
 
-        virtual std::type_index GetTypeIndex() const = 0;
+        /**
+         * @brief Type the resource is stored under, must be TypeInfo<Resource>::GetTypeId<Derived>()
+         * of the most derived class since Resources::Find<T> casts on a match.
+         */
+        virtual TypeId GetTypeId() const = 0;
     };
 }
\ No newline at end of file
@@ -36,9 +36,12 @@ namespace SF::Engine
         }
     }
 
-    std::shared_ptr<Resource> Resources::Find(const std::type_index &typeIndex, char *name) const
+    std::shared_ptr<Resource> Resources::Find(TypeId typeId, SFTL::InternedString name) const
     {
-        auto typeIt = resources.find(typeIndex);
+        if (name.empty())
+            return nullptr;
+
+        auto typeIt = resources.find(typeId);
         if (typeIt == resources.end())
             return nullptr;
 
@@ -50,27 +53,23 @@ namespace SF::Engine
         return resourceIt->second;
     }
 
-    template <typename T>
-    std::shared_ptr<T> Resources::Find(const char *data) const
+    std::shared_ptr<Resource> Resources::Find(TypeId typeId, char *name) const
     {
-        auto resource = Find(typeid(T), const_cast<char *>(data));
-        if (!resource)
-            return nullptr;
-
-        return std::dynamic_pointer_cast<T>(resource);
+        // A name that was never interned cannot have been added
+        return Find(typeId, SFTL::InternedString::Find(name));
     }
 
     void Resources::Add(const std::shared_ptr<Resource> &resource, char *name)
     {
-        if (Find(resource->GetTypeIndex(), name))
+        if (Find(resource->GetTypeId(), name))
             return;
 
-        resources[resource->GetTypeIndex()].emplace(name, resource);
+        resources[resource->GetTypeId()].emplace(SFTL::InternedString(name), resource);
     }
 
     void Resources::Remove(const std::shared_ptr<Resource> &resource)
     {
-        auto typeIt = resources.find(resource->GetTypeIndex());
+        auto typeIt = resources.find(resource->GetTypeId());
         if (typeIt == resources.end())
             return;
 
@@ -85,6 +84,6 @@ namespace SF::Engine
         }
 
         if (typeMap.empty())
-            resources.erase(resource->GetTypeIndex());
+            resources.erase(resource->GetTypeId());
     }
 }
\ No newline at end of file
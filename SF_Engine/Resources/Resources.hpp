@@ -2,10 +2,10 @@
 
 #include <unordered_map>
 #include <memory>
-#include <typeindex>
 
 #include "Engine/Engine.hpp"
 #include <UtilityClasses/ThreadPool.hpp>
+#include <TemplateLibrary/String.hpp>
 #include "Resource.hpp"
 
 namespace SF::Engine
@@ -25,10 +25,30 @@ namespace SF::Engine
 
         void Update() override;
 
-        std::shared_ptr<Resource> Find(const std::type_index &typeIndex, char *name) const;
+        /**
+         * @brief Looks a resource up by an interned name, which only hashes the name's pointer.
+         * Hot paths should intern their names once and use this overload.
+         */
+        std::shared_ptr<Resource> Find(TypeId typeId, SFTL::InternedString name) const;
+
+        /**
+         * @brief Convenience overload, first finds the name in the intern table (hashing the whole
+         * string under the table's lock).
+         */
+        std::shared_ptr<Resource> Find(TypeId typeId, char *name) const;
+
+        template <typename T>
+        std::shared_ptr<T> Find(SFTL::InternedString name) const
+        {
+            // Stored under T's id means GetTypeId() said it is a T, no dynamic cast needed
+            return std::static_pointer_cast<T>(Find(TypeInfo<Resource>::GetTypeId<T>(), name));
+        }
 
         template <typename T>
-        std::shared_ptr<T> Find(const char *data) const;
+        std::shared_ptr<T> Find(const char *data) const
+        {
+            return std::static_pointer_cast<T>(Find(TypeInfo<Resource>::GetTypeId<T>(), const_cast<char *>(data)));
+        }
 
         void Add(const std::shared_ptr<Resource> &resource, char *name);
         void Remove(const std::shared_ptr<Resource> &resource);
@@ -40,9 +60,9 @@ namespace SF::Engine
         ThreadPool &GetThreadPool() { return threadPool; }
 
     private:
-        // Map from type_index to map of names to resources
-        std::unordered_map<std::type_index,
-                           std::unordered_map<std::string, std::shared_ptr<Resource>>>
+        // Map from resource type ID to map of names to resources, keyed by interned name
+        std::unordered_map<TypeId,
+                           std::unordered_map<SFTL::InternedString, std::shared_ptr<Resource>>>
             resources;
 
         SF::Engine::ElapsedTime elapsedPurge;
@@ -0,0 +1,729 @@
+/******************************************************************************/
+/* Allocators.hpp                                                             */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+#include <new>
+#include <limits>
+#include <atomic>
+#include <type_traits>
+#include <memory_resource>
+
+// Engine allocators. Every allocator here is a std::pmr::memory_resource (so it
+// can back any pmr container, including SFTL::Polymorphic::DynamicArray) and can
+// also be used without virtual dispatch through SFTL::Allocator<T, Resource>.
+//
+// None of them are thread-safe on their own; use one per thread (FrameAllocator
+// already does this for you) or guard them externally.
+namespace SFTL
+{
+    /**
+     * @brief Usage counters kept by every SFTL allocator.
+     */
+    struct AllocatorStats
+    {
+        size_t bytesInUse = 0;        // Bytes currently handed out to callers
+        size_t peakBytesInUse = 0;    // Highest value bytesInUse ever reached
+        size_t bytesReserved = 0;     // Bytes currently held from the upstream resource
+        size_t allocationCount = 0;   // Total successful allocations
+        size_t deallocationCount = 0; // Total deallocations (including resets)
+    };
+
+    namespace Detail
+    {
+        // Patterns written over memory in debug builds so stale reads stand out
+        inline constexpr unsigned char AllocatedPoison = 0xCD;
+        inline constexpr unsigned char FreedPoison = 0xDD;
+
+        inline void PoisonAllocated([[maybe_unused]] void *ptr, [[maybe_unused]] size_t bytes) noexcept
+        {
+#ifndef NDEBUG
+            std::memset(ptr, AllocatedPoison, bytes);
+#endif
+        }
+
+        inline void PoisonFreed([[maybe_unused]] void *ptr, [[maybe_unused]] size_t bytes) noexcept
+        {
+#ifndef NDEBUG
+            std::memset(ptr, FreedPoison, bytes);
+#endif
+        }
+
+        constexpr bool IsPowerOfTwo(size_t value) noexcept
+        {
+            return value != 0 && (value & (value - 1)) == 0;
+        }
+
+        constexpr size_t AlignUp(size_t value, size_t alignment) noexcept
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        inline std::byte *AlignUp(std::byte *ptr, size_t alignment) noexcept
+        {
+            return reinterpret_cast<std::byte *>(
+                AlignUp(reinterpret_cast<uintptr_t>(ptr), alignment));
+        }
+
+        inline void RecordAllocation(AllocatorStats &stats, size_t bytes) noexcept
+        {
+            stats.bytesInUse += bytes;
+            ++stats.allocationCount;
+            if (stats.bytesInUse > stats.peakBytesInUse)
+                stats.peakBytesInUse = stats.bytesInUse;
+        }
+
+        inline void RecordDeallocation(AllocatorStats &stats, size_t bytes) noexcept
+        {
+            assert(stats.bytesInUse >= bytes);
+            stats.bytesInUse -= bytes;
+            ++stats.deallocationCount;
+        }
+    }
+
+    /**
+     * @brief Standard allocator adapter over any SFTL allocator.
+     *
+     * Calls Resource::Allocate/Deallocate directly, so unlike
+     * std::pmr::polymorphic_allocator there is no virtual call per allocation.
+     * Usage: DynamicArray<int, Allocator<int, MonotonicArena>> ids{Allocator<int, MonotonicArena>(arena)};
+     */
+    template <typename T, typename Resource>
+    class Allocator
+    {
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        Allocator() noexcept = default;
+
+        Allocator(Resource &resource) noexcept
+            : resource_(&resource)
+        {
+        }
+
+        template <typename U>
+        Allocator(const Allocator<U, Resource> &other) noexcept
+            : resource_(other.resource_)
+        {
+        }
+
+        [[nodiscard]] T *allocate(size_t count)
+        {
+            assert(resource_ && "SFTL::Allocator used without a resource");
+            if (count > std::numeric_limits<size_t>::max() / sizeof(T))
+                throw std::bad_array_new_length();
+
+            return static_cast<T *>(resource_->Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T *ptr, size_t count) noexcept
+        {
+            resource_->Deallocate(ptr, count * sizeof(T), alignof(T));
+        }
+
+        Resource *resource() const noexcept { return resource_; }
+
+        template <typename U>
+        friend bool operator==(const Allocator &a, const Allocator<U, Resource> &b) noexcept
+        {
+            return a.resource_ == b.resource_;
+        }
+
+    private:
+        template <typename, typename>
+        friend class Allocator;
+
+        Resource *resource_ = nullptr;
+    };
+
+    /**
+     * @brief Bump allocator that only frees memory all at once.
+     *
+     * Grows by requesting blocks from the upstream resource. Reset() rewinds to
+     * the first block and keeps every block for reuse; Release() gives them back.
+     */
+    class MonotonicArena : public std::pmr::memory_resource
+    {
+    public:
+        explicit MonotonicArena(size_t initialBlockSize = 64 * 1024,
+                                std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+            : nextBlockSize_(initialBlockSize < MinBlockSize ? MinBlockSize : initialBlockSize),
+              upstream_(upstream)
+        {
+        }
+
+        ~MonotonicArena() override { Release(); }
+
+        MonotonicArena(const MonotonicArena &) = delete;
+        MonotonicArena &operator=(const MonotonicArena &) = delete;
+
+        [[nodiscard]] void *Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t))
+        {
+            assert(Detail::IsPowerOfTwo(alignment));
+
+            std::byte *ptr = current_ ? Detail::AlignUp(cursor_, alignment) : nullptr;
+            while (!ptr || ptr + bytes > end_)
+                ptr = NextBlock(bytes, alignment);
+
+            cursor_ = ptr + bytes;
+            Detail::RecordAllocation(stats_, bytes);
+            Detail::PoisonAllocated(ptr, bytes);
+            return ptr;
+        }
+
+        // Individual deallocations are no-ops apart from bookkeeping
+        void Deallocate(void *ptr, size_t bytes, size_t = alignof(std::max_align_t)) noexcept
+        {
+            if (!ptr)
+                return;
+
+            Detail::RecordDeallocation(stats_, bytes);
+            Detail::PoisonFreed(ptr, bytes);
+        }
+
+        /**
+         * @brief Frees every allocation at once, keeping the blocks for reuse.
+         */
+        void Reset() noexcept
+        {
+            for (Block *block = first_; block; block = block->next)
+            {
+                Detail::PoisonFreed(block->Begin(), block->End() - block->Begin());
+                if (block == current_)
+                    break;
+            }
+
+            if (stats_.bytesInUse)
+                ++stats_.deallocationCount;
+            stats_.bytesInUse = 0;
+
+            current_ = first_;
+            cursor_ = first_ ? first_->Begin() : nullptr;
+            end_ = first_ ? first_->End() : nullptr;
+        }
+
+        /**
+         * @brief Frees every allocation and returns all blocks to the upstream resource.
+         */
+        void Release() noexcept
+        {
+            Reset();
+
+            for (Block *block = first_; block;)
+            {
+                Block *next = block->next;
+                upstream_->deallocate(block, block->size, alignof(Block));
+                block = next;
+            }
+
+            first_ = current_ = nullptr;
+            cursor_ = end_ = nullptr;
+            stats_.bytesReserved = 0;
+        }
+
+        const AllocatorStats &GetStats() const noexcept { return stats_; }
+        std::pmr::memory_resource *GetUpstream() const noexcept { return upstream_; }
+
+    protected:
+        void *do_allocate(size_t bytes, size_t alignment) override { return Allocate(bytes, alignment); }
+        void do_deallocate(void *ptr, size_t bytes, size_t alignment) override { Deallocate(ptr, bytes, alignment); }
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+    private:
+        static constexpr size_t MinBlockSize = 1024;
+
+        struct alignas(std::max_align_t) Block
+        {
+            Block *next;
+            size_t size; // Including this header
+
+            std::byte *Begin() noexcept { return reinterpret_cast<std::byte *>(this + 1); }
+            std::byte *End() noexcept { return reinterpret_cast<std::byte *>(this) + size; }
+        };
+
+        // Moves to the next kept block, or links in a new one big enough for the request
+        std::byte *NextBlock(size_t bytes, size_t alignment)
+        {
+            Block *next = current_ ? current_->next : first_;
+            const size_t needed = sizeof(Block) + bytes + alignment;
+
+            if (!next || next->size < needed)
+            {
+                const size_t size = needed > nextBlockSize_ ? Detail::AlignUp(needed, MinBlockSize) : nextBlockSize_;
+                nextBlockSize_ *= 2;
+
+                Block *block = static_cast<Block *>(upstream_->allocate(size, alignof(Block)));
+                block->size = size;
+                block->next = next;
+                stats_.bytesReserved += size;
+
+                if (current_)
+                    current_->next = block;
+                else
+                    first_ = block;
+                next = block;
+            }
+
+            current_ = next;
+            cursor_ = next->Begin();
+            end_ = next->End();
+            return Detail::AlignUp(cursor_, alignment);
+        }
+
+        Block *first_ = nullptr;
+        Block *current_ = nullptr;
+        std::byte *cursor_ = nullptr;
+        std::byte *end_ = nullptr;
+
+        size_t nextBlockSize_;
+        std::pmr::memory_resource *upstream_;
+        AllocatorStats stats_;
+    };
+
+    /**
+     * @brief Pool of equally sized blocks backed by an intrusive free list.
+     *
+     * Allocation and deallocation are O(1). Requests larger than the block size
+     * (or more aligned than the block alignment) throw std::bad_alloc.
+     */
+    class PoolAllocator : public std::pmr::memory_resource
+    {
+    public:
+        explicit PoolAllocator(size_t blockSize, size_t blocksPerPage = 256,
+                               std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+            : blockSize_(Detail::AlignUp(blockSize < sizeof(FreeNode) ? sizeof(FreeNode) : blockSize, alignof(FreeNode))),
+              blocksPerPage_(blocksPerPage ? blocksPerPage : 1),
+              upstream_(upstream)
+        {
+        }
+
+        ~PoolAllocator() override { Release(); }
+
+        PoolAllocator(const PoolAllocator &) = delete;
+        PoolAllocator &operator=(const PoolAllocator &) = delete;
+
+        [[nodiscard]] void *Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t))
+        {
+            // A block too small or misaligned would be overrun by the caller, refused in every build
+            if (bytes > blockSize_ || alignment > BlockAlignment())
+                throw std::bad_alloc();
+
+            if (!freeList_)
+                AddPage();
+
+            FreeNode *node = freeList_;
+            freeList_ = node->next;
+
+            Detail::RecordAllocation(stats_, blockSize_);
+            Detail::PoisonAllocated(node, blockSize_);
+            return node;
+        }
+
+        void Deallocate(void *ptr, size_t = 0, size_t = alignof(std::max_align_t)) noexcept
+        {
+            if (!ptr)
+                return;
+
+            Detail::RecordDeallocation(stats_, blockSize_);
+            Detail::PoisonFreed(ptr, blockSize_);
+
+            FreeNode *node = static_cast<FreeNode *>(ptr);
+            node->next = freeList_;
+            freeList_ = node;
+        }
+
+        /**
+         * @brief Returns every page to the upstream resource. All blocks must have been freed.
+         */
+        void Release() noexcept
+        {
+            assert(stats_.bytesInUse == 0 && "PoolAllocator released with live blocks");
+
+            for (Page *page = pages_; page;)
+            {
+                Page *next = page->next;
+                upstream_->deallocate(page, PageSize(), alignof(Page));
+                page = next;
+            }
+
+            pages_ = nullptr;
+            freeList_ = nullptr;
+            stats_.bytesReserved = 0;
+        }
+
+        size_t GetBlockSize() const noexcept { return blockSize_; }
+        const AllocatorStats &GetStats() const noexcept { return stats_; }
+
+        static constexpr size_t BlockAlignment() noexcept { return alignof(std::max_align_t); }
+
+    protected:
+        void *do_allocate(size_t bytes, size_t alignment) override { return Allocate(bytes, alignment); }
+        void do_deallocate(void *ptr, size_t bytes, size_t alignment) override { Deallocate(ptr, bytes, alignment); }
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+    private:
+        struct FreeNode
+        {
+            FreeNode *next;
+        };
+
+        struct alignas(std::max_align_t) Page
+        {
+            Page *next;
+        };
+
+        size_t Stride() const noexcept { return Detail::AlignUp(blockSize_, BlockAlignment()); }
+        size_t PageSize() const noexcept { return sizeof(Page) + Stride() * blocksPerPage_; }
+
+        void AddPage()
+        {
+            Page *page = static_cast<Page *>(upstream_->allocate(PageSize(), alignof(Page)));
+            page->next = pages_;
+            pages_ = page;
+            stats_.bytesReserved += PageSize();
+
+            // Thread the new blocks onto the free list, lowest address first
+            std::byte *blocks = reinterpret_cast<std::byte *>(page + 1);
+            const size_t stride = Stride();
+            for (size_t i = blocksPerPage_; i-- > 0;)
+            {
+                FreeNode *node = reinterpret_cast<FreeNode *>(blocks + i * stride);
+                node->next = freeList_;
+                freeList_ = node;
+            }
+        }
+
+        size_t blockSize_;
+        size_t blocksPerPage_;
+        std::pmr::memory_resource *upstream_;
+
+        Page *pages_ = nullptr;
+        FreeNode *freeList_ = nullptr;
+        AllocatorStats stats_;
+    };
+
+    /**
+     * @brief General purpose allocator built from power-of-two PoolAllocators.
+     *
+     * Requests up to MaxPooledSize bytes are served by the matching size class
+     * (16, 32, ... 2048 bytes); anything larger goes straight to the upstream resource.
+     */
+    class SizeClassAllocator : public std::pmr::memory_resource
+    {
+    public:
+        static constexpr size_t MinPooledSize = 16;
+        static constexpr size_t MaxPooledSize = 2048;
+        static constexpr size_t SizeClassCount = 8;
+
+        explicit SizeClassAllocator(std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+            : pools_{PoolAllocator(16, 512, upstream), PoolAllocator(32, 256, upstream),
+                     PoolAllocator(64, 256, upstream), PoolAllocator(128, 128, upstream),
+                     PoolAllocator(256, 64, upstream), PoolAllocator(512, 32, upstream),
+                     PoolAllocator(1024, 16, upstream), PoolAllocator(2048, 8, upstream)},
+              upstream_(upstream)
+        {
+        }
+
+        SizeClassAllocator(const SizeClassAllocator &) = delete;
+        SizeClassAllocator &operator=(const SizeClassAllocator &) = delete;
+
+        [[nodiscard]] void *Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t))
+        {
+            void *ptr = nullptr;
+            if (bytes <= MaxPooledSize && alignment <= PoolAllocator::BlockAlignment())
+            {
+                ptr = pools_[SizeClassIndex(bytes)].Allocate(bytes, alignment);
+            }
+            else
+            {
+                ptr = upstream_->allocate(bytes, alignment);
+                Detail::PoisonAllocated(ptr, bytes);
+            }
+
+            Detail::RecordAllocation(stats_, bytes);
+            return ptr;
+        }
+
+        void Deallocate(void *ptr, size_t bytes, size_t alignment = alignof(std::max_align_t)) noexcept
+        {
+            if (!ptr)
+                return;
+
+            Detail::RecordDeallocation(stats_, bytes);
+
+            if (bytes <= MaxPooledSize && alignment <= PoolAllocator::BlockAlignment())
+            {
+                pools_[SizeClassIndex(bytes)].Deallocate(ptr, bytes, alignment);
+            }
+            else
+            {
+                Detail::PoisonFreed(ptr, bytes);
+                upstream_->deallocate(ptr, bytes, alignment);
+            }
+        }
+
+        /**
+         * @brief Stats as seen by callers (requested bytes, not rounded up to the size class).
+         */
+        const AllocatorStats &GetStats() const noexcept { return stats_; }
+
+        const PoolAllocator &GetSizeClass(size_t index) const noexcept
+        {
+            assert(index < SizeClassCount);
+            return pools_[index];
+        }
+
+        static constexpr size_t SizeClassIndex(size_t bytes) noexcept
+        {
+            size_t index = 0;
+            for (size_t size = MinPooledSize; size < bytes; size <<= 1)
+                ++index;
+            return index;
+        }
+
+    protected:
+        void *do_allocate(size_t bytes, size_t alignment) override { return Allocate(bytes, alignment); }
+        void do_deallocate(void *ptr, size_t bytes, size_t alignment) override { Deallocate(ptr, bytes, alignment); }
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+    private:
+        PoolAllocator pools_[SizeClassCount];
+        std::pmr::memory_resource *upstream_;
+        AllocatorStats stats_;
+    };
+
+    /**
+     * @brief Fixed capacity LIFO allocator that rolls back to saved markers.
+     */
+    class StackAllocator : public std::pmr::memory_resource
+    {
+    public:
+        using Marker = size_t;
+
+        /**
+         * @brief Restores the stack to the marker taken at construction when it goes out of scope.
+         */
+        class ScopedMarker
+        {
+        public:
+            explicit ScopedMarker(StackAllocator &stack) noexcept
+                : stack_(stack), marker_(stack.GetMarker())
+            {
+            }
+
+            ~ScopedMarker() { stack_.FreeToMarker(marker_); }
+
+            ScopedMarker(const ScopedMarker &) = delete;
+            ScopedMarker &operator=(const ScopedMarker &) = delete;
+
+        private:
+            StackAllocator &stack_;
+            Marker marker_;
+        };
+
+        explicit StackAllocator(size_t capacity,
+                                std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+            : capacity_(capacity), upstream_(upstream)
+        {
+            buffer_ = static_cast<std::byte *>(upstream_->allocate(capacity_, alignof(std::max_align_t)));
+            stats_.bytesReserved = capacity_;
+            Detail::PoisonFreed(buffer_, capacity_);
+        }
+
+        ~StackAllocator() override
+        {
+            upstream_->deallocate(buffer_, capacity_, alignof(std::max_align_t));
+        }
+
+        StackAllocator(const StackAllocator &) = delete;
+        StackAllocator &operator=(const StackAllocator &) = delete;
+
+        [[nodiscard]] void *Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t))
+        {
+            assert(Detail::IsPowerOfTwo(alignment));
+
+            std::byte *ptr = Detail::AlignUp(buffer_ + top_, alignment);
+            if (ptr + bytes > buffer_ + capacity_)
+                throw std::bad_alloc();
+
+            top_ = static_cast<size_t>(ptr + bytes - buffer_);
+            Detail::RecordAllocation(stats_, bytes);
+            Detail::PoisonAllocated(ptr, bytes);
+            return ptr;
+        }
+
+        // Only the most recent allocation actually gives memory back; others wait for a marker
+        void Deallocate(void *ptr, size_t bytes, size_t = alignof(std::max_align_t)) noexcept
+        {
+            if (!ptr)
+                return;
+
+            Detail::RecordDeallocation(stats_, bytes);
+            Detail::PoisonFreed(ptr, bytes);
+
+            std::byte *block = static_cast<std::byte *>(ptr);
+            if (block + bytes == buffer_ + top_)
+                top_ = static_cast<size_t>(block - buffer_);
+        }
+
+        Marker GetMarker() const noexcept { return top_; }
+
+        /**
+         * @brief Frees everything allocated after the marker was taken.
+         */
+        void FreeToMarker(Marker marker) noexcept
+        {
+            assert(marker <= top_ && "StackAllocator marker freed out of order");
+            if (marker >= top_)
+                return;
+
+            Detail::PoisonFreed(buffer_ + marker, top_ - marker);
+
+            const size_t freed = top_ - marker;
+            stats_.bytesInUse = stats_.bytesInUse > freed ? stats_.bytesInUse - freed : 0;
+            ++stats_.deallocationCount;
+            top_ = marker;
+        }
+
+        void Reset() noexcept { FreeToMarker(0); }
+
+        size_t GetCapacity() const noexcept { return capacity_; }
+        size_t GetUsed() const noexcept { return top_; }
+        const AllocatorStats &GetStats() const noexcept { return stats_; }
+
+    protected:
+        void *do_allocate(size_t bytes, size_t alignment) override { return Allocate(bytes, alignment); }
+        void do_deallocate(void *ptr, size_t bytes, size_t alignment) override { Deallocate(ptr, bytes, alignment); }
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+    private:
+        std::byte *buffer_ = nullptr;
+        size_t capacity_;
+        size_t top_ = 0;
+        std::pmr::memory_resource *upstream_;
+        AllocatorStats stats_;
+    };
+
+    /**
+     * @brief Per-thread scratch allocator whose memory lives for two frames.
+     *
+     * Call FrameAllocator::BeginFrame() once per frame (the engine does this);
+     * each thread's allocator notices the new frame on its next allocation and
+     * recycles the arena it used two frames ago. Memory allocated this frame is
+     * therefore still valid for the whole of the next frame.
+     */
+    class FrameAllocator : public std::pmr::memory_resource
+    {
+    public:
+        explicit FrameAllocator(size_t blockSize = 256 * 1024)
+            : arenas_{MonotonicArena(blockSize), MonotonicArena(blockSize)}
+        {
+        }
+
+        FrameAllocator(const FrameAllocator &) = delete;
+        FrameAllocator &operator=(const FrameAllocator &) = delete;
+
+        /**
+         * @brief Gets the calling thread's frame allocator.
+         */
+        static FrameAllocator &ThreadLocal()
+        {
+            thread_local FrameAllocator instance;
+            return instance;
+        }
+
+        /**
+         * @brief Advances the global frame counter, invalidating allocations from two frames ago.
+         */
+        static void BeginFrame() noexcept { FrameIndex().fetch_add(1, std::memory_order_release); }
+
+        static uint64_t GetFrameIndex() noexcept { return FrameIndex().load(std::memory_order_acquire); }
+
+        [[nodiscard]] void *Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t))
+        {
+            Sync();
+            return arenas_[frame_ & 1].Allocate(bytes, alignment);
+        }
+
+        // Frame memory is reclaimed in bulk; individual frees are only poisoned
+        void Deallocate(void *ptr, size_t bytes, size_t = alignof(std::max_align_t)) noexcept
+        {
+            if (ptr)
+                Detail::PoisonFreed(ptr, bytes);
+        }
+
+        /**
+         * @brief Stats for the current (or previous) frame's arena. bytesInUse counts bytes allocated during that frame.
+         */
+        const AllocatorStats &GetStats(bool previousFrame = false) const noexcept
+        {
+            return arenas_[(frame_ + (previousFrame ? 1 : 0)) & 1].GetStats();
+        }
+
+    protected:
+        void *do_allocate(size_t bytes, size_t alignment) override { return Allocate(bytes, alignment); }
+        void do_deallocate(void *ptr, size_t bytes, size_t alignment) override { Deallocate(ptr, bytes, alignment); }
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+    private:
+        static std::atomic<uint64_t> &FrameIndex() noexcept
+        {
+            static std::atomic<uint64_t> index = 0;
+            return index;
+        }
+
+        void Sync() noexcept
+        {
+            const uint64_t frame = GetFrameIndex();
+            if (frame == frame_)
+                return;
+
+            // Skipped more than one frame: both arenas are stale
+            if (frame - frame_ > 1)
+                arenas_[(frame + 1) & 1].Reset();
+
+            arenas_[frame & 1].Reset();
+            frame_ = frame;
+        }
+
+        MonotonicArena arenas_[2];
+        uint64_t frame_ = 0;
+    };
+}
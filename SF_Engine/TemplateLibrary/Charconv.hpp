@@ -0,0 +1,209 @@
+/******************************************************************************/
+/* Charconv.hpp                                                               */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+// Number to text conversion. Integers are written two digits at a time from a
+// "00".."99" table; floats use the standard library's shortest round-trip to_chars
+// (Ryu based in libstdc++ and the MSVC STL).
+namespace SFTL
+{
+    /**
+     * @brief Upper bound on the characters ToChars writes for an integer of type T, sign included.
+     */
+    template <typename T>
+        requires std::is_integral_v<T>
+    inline constexpr size_t MaxIntegerChars = std::numeric_limits<T>::digits10 + 1 + (std::is_signed_v<T> ? 1 : 0);
+
+    /**
+     * @brief Upper bound on the characters of a shortest round-trip float or double ("-2.2250738585072014e-308").
+     */
+    inline constexpr size_t MaxShortestFloatChars = 24;
+
+    namespace Detail
+    {
+        inline constexpr char DigitPairs[201] =
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+
+        template <typename U>
+        constexpr uint32_t CountDigits(U value) noexcept
+        {
+            uint32_t digits = 1;
+            while (true)
+            {
+                if (value < 10)
+                    return digits;
+                if (value < 100)
+                    return digits + 1;
+                if (value < 1000)
+                    return digits + 2;
+                if (value < 10000)
+                    return digits + 3;
+                value /= 10000u;
+                digits += 4;
+            }
+        }
+
+        // Writes the digits of value so they end at end, returns the first written character
+        template <typename U>
+        constexpr char *WriteDigitsBackwards(char *end, U value) noexcept
+        {
+            while (value >= 100)
+            {
+                const size_t pair = static_cast<size_t>(value % 100) * 2;
+                value /= 100;
+                *--end = DigitPairs[pair + 1];
+                *--end = DigitPairs[pair];
+            }
+
+            if (value >= 10)
+            {
+                const size_t pair = static_cast<size_t>(value) * 2;
+                *--end = DigitPairs[pair + 1];
+                *--end = DigitPairs[pair];
+            }
+            else
+            {
+                *--end = static_cast<char>('0' + value);
+            }
+            return end;
+        }
+
+        template <typename U>
+        constexpr char *WriteUnsigned(char *out, U value) noexcept
+        {
+            char *end = out + CountDigits(value);
+
+            // 32-bit division is considerably cheaper, switch once the value fits
+            if constexpr (sizeof(U) > sizeof(uint32_t))
+            {
+                char *cursor = end;
+                while (value > std::numeric_limits<uint32_t>::max())
+                {
+                    uint32_t low = static_cast<uint32_t>(value % 100000000u);
+                    value /= 100000000u;
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        const size_t pair = static_cast<size_t>(low % 100) * 2;
+                        low /= 100;
+                        *--cursor = DigitPairs[pair + 1];
+                        *--cursor = DigitPairs[pair];
+                    }
+                }
+                WriteDigitsBackwards(cursor, static_cast<uint32_t>(value));
+            }
+            else
+            {
+                WriteDigitsBackwards(end, static_cast<uint32_t>(value));
+            }
+            return end;
+        }
+    }
+
+    /**
+     * @brief Writes value in base 10 without bounds checks, out must have MaxIntegerChars<T> free.
+     * @return One past the last written character.
+     */
+    template <typename T>
+        requires(std::is_integral_v<T> && !std::is_same_v<T, bool>)
+    constexpr char *WriteInteger(char *out, T value) noexcept
+    {
+        using U = std::make_unsigned_t<T>;
+        if constexpr (std::is_signed_v<T>)
+        {
+            if (value < 0)
+            {
+                *out++ = '-';
+                return Detail::WriteUnsigned(out, static_cast<U>(U(0) - static_cast<U>(value)));
+            }
+        }
+        return Detail::WriteUnsigned(out, static_cast<U>(value));
+    }
+
+    /**
+     * @brief Base 10 integer to text, same contract as std::to_chars.
+     */
+    template <typename T>
+        requires(std::is_integral_v<T> && !std::is_same_v<T, bool>)
+    constexpr std::to_chars_result ToChars(char *first, char *last, T value) noexcept
+    {
+        if (static_cast<size_t>(last - first) >= MaxIntegerChars<T>)
+            return {WriteInteger(first, value), std::errc()};
+
+        // Not enough room for the worst case, check the exact length
+        using U = std::make_unsigned_t<T>;
+        const bool negative = std::is_signed_v<T> && value < T(0);
+        const U magnitude = negative ? static_cast<U>(U(0) - static_cast<U>(value)) : static_cast<U>(value);
+        const size_t length = Detail::CountDigits(magnitude) + (negative ? 1 : 0);
+        if (static_cast<size_t>(last - first) < length)
+            return {last, std::errc::value_too_large};
+
+        return {WriteInteger(first, value), std::errc()};
+    }
+
+    /**
+     * @brief Shortest text that parses back to exactly value.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    inline std::to_chars_result ToChars(char *first, char *last, T value) noexcept
+    {
+        return std::to_chars(first, last, value);
+    }
+
+    /**
+     * @brief Float to text in a given format and precision.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    inline std::to_chars_result ToChars(char *first, char *last, T value, std::chars_format format, int precision) noexcept
+    {
+        return std::to_chars(first, last, value, format, precision);
+    }
+}
@@ -32,10 +32,16 @@
 /* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
 /******************************************************************************/
 #pragma once
+#include <cstring>
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
 #include <utility>
 #include <cassert>
 
+#include <TemplateLibrary/Move.hpp>
+#include <TemplateLibrary/Search.hpp>
+
 namespace SFTL
 {
     template <typename T, class Allocator = std::allocator<T>>
@@ -59,10 +65,6 @@ namespace SFTL
                 allocator_.deallocate(data_, capacity_);
         }
 
-        // no copy yet (keep it simple)
-        DynamicArray(const DynamicArray &) = delete;
-        DynamicArray &operator=(const DynamicArray &) = delete;
-
         // move is cheap and sane
         DynamicArray(DynamicArray &&other) noexcept
         {
@@ -107,12 +109,17 @@ namespace SFTL
             if (a.size_ != b.size_)
                 return false;
 
-            for (size_t i = 0; i < a.size_; ++i)
+            if constexpr (SimdSearchable<T>)
+                return Equal(a.data_, b.data_, a.size_);
+            else
             {
-                if (!(a.data_[i] == b.data_[i]))
-                    return false;
+                for (size_t i = 0; i < a.size_; ++i)
+                {
+                    if (!(a.data_[i] == b.data_[i]))
+                        return false;
+                }
+                return true;
             }
-            return true;
         }
 
     private:
@@ -244,9 +251,17 @@ namespace SFTL
 
             if (newSize > size_)
             {
-                for (size_t i = size_; i < newSize; ++i)
-                    std::allocator_traits<Allocator>::construct(
-                        allocator_, data_ + i);
+                // Value-initializing a trivial T through std::allocator is zero filling
+                if constexpr (std::is_trivial_v<T> && std::is_same_v<Allocator, std::allocator<T>>)
+                {
+                    std::memset(static_cast<void *>(data_ + size_), 0, (newSize - size_) * sizeof(T));
+                }
+                else
+                {
+                    for (size_t i = size_; i < newSize; ++i)
+                        std::allocator_traits<Allocator>::construct(
+                            allocator_, data_ + i);
+                }
             }
             else if (newSize < size_)
             {
@@ -439,9 +454,61 @@ namespace SFTL
         {
             return !(a == b);
         }
+        // Pointer to the first element equal to value, or end()
+        T *find(const T &value)
+        {
+            return data_ + Find(data_, size_, value);
+        }
+
+        const T *find(const T &value) const
+        {
+            return data_ + Find(data_, size_, value);
+        }
+
+        bool contains(const T &value) const
+        {
+            return Find(data_, size_, value) != size_;
+        }
+
+        size_t count(const T &value) const
+        {
+            return Count(data_, size_, value);
+        }
+
+        // Smallest / largest element value (array must not be empty)
+        T min() const
+        {
+            assert(size_ > 0);
+            return Min(data_, size_);
+        }
+
+        T max() const
+        {
+            assert(size_ > 0);
+            return Max(data_, size_);
+        }
+
         // Remove all elements matching a value (maintains order)
         size_t remove(const T &value)
         {
+            if constexpr (SimdSearchable<T>)
+            {
+                // Skip the untouched prefix with the vector search, then compact branch-free
+                size_t readIndex = Find(data_, size_, value);
+                size_t writeIndex = readIndex;
+
+                for (; readIndex < size_; ++readIndex)
+                {
+                    const T element = data_[readIndex];
+                    data_[writeIndex] = element;
+                    writeIndex += element == value ? 0 : 1;
+                }
+
+                const size_t removed = size_ - writeIndex;
+                size_ = writeIndex;
+                return removed;
+            }
+
             T *writePos = data_;
             size_t removed = 0;
 
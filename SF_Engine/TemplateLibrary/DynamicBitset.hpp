@@ -0,0 +1,536 @@
+/******************************************************************************/
+/* DynamicBitset.hpp                                                          */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#include <TemplateLibrary/Dynamic.hpp>
+#include <TemplateLibrary/Simd.hpp>
+
+namespace SFTL
+{
+    namespace Detail
+    {
+        // Word kernels behind DynamicBitset. They work on whole 64-bit words and
+        // use the widest vectors available, finishing the tail one word at a time.
+
+        inline void BitsAnd(uint64_t *dst, const uint64_t *src, size_t words) noexcept
+        {
+            size_t i = 0;
+#if defined(SFTL_SIMD_AVX2)
+            for (; i + 4 <= words; i += 4)
+            {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_and_si256(a, b));
+            }
+#elif defined(SFTL_SIMD_SSE2)
+            for (; i + 2 <= words; i += 2)
+            {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_and_si128(a, b));
+            }
+#endif
+            for (; i < words; ++i)
+                dst[i] &= src[i];
+        }
+
+        inline void BitsOr(uint64_t *dst, const uint64_t *src, size_t words) noexcept
+        {
+            size_t i = 0;
+#if defined(SFTL_SIMD_AVX2)
+            for (; i + 4 <= words; i += 4)
+            {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_or_si256(a, b));
+            }
+#elif defined(SFTL_SIMD_SSE2)
+            for (; i + 2 <= words; i += 2)
+            {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_or_si128(a, b));
+            }
+#endif
+            for (; i < words; ++i)
+                dst[i] |= src[i];
+        }
+
+        inline void BitsXor(uint64_t *dst, const uint64_t *src, size_t words) noexcept
+        {
+            size_t i = 0;
+#if defined(SFTL_SIMD_AVX2)
+            for (; i + 4 <= words; i += 4)
+            {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_xor_si256(a, b));
+            }
+#elif defined(SFTL_SIMD_SSE2)
+            for (; i + 2 <= words; i += 2)
+            {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_xor_si128(a, b));
+            }
+#endif
+            for (; i < words; ++i)
+                dst[i] ^= src[i];
+        }
+
+        // dst &= ~src
+        inline void BitsAndNot(uint64_t *dst, const uint64_t *src, size_t words) noexcept
+        {
+            size_t i = 0;
+#if defined(SFTL_SIMD_AVX2)
+            for (; i + 4 <= words; i += 4)
+            {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_andnot_si256(b, a));
+            }
+#elif defined(SFTL_SIMD_SSE2)
+            for (; i + 2 <= words; i += 2)
+            {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_andnot_si128(b, a));
+            }
+#endif
+            for (; i < words; ++i)
+                dst[i] &= ~src[i];
+        }
+
+        inline size_t BitsPopCount(const uint64_t *words, size_t count) noexcept
+        {
+            size_t total = 0;
+            size_t i = 0;
+#if defined(SFTL_SIMD_AVX2)
+            // Nibble lookup (Mula): popcount each byte with a shuffle, then sum bytes with SAD
+            const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const __m256i lowMask = _mm256_set1_epi8(0x0F);
+            __m256i acc = _mm256_setzero_si256();
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words + i));
+                const __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, lowMask));
+                const __m256i hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), lowMask));
+                acc = _mm256_add_epi64(acc, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+            }
+            total += static_cast<size_t>(_mm256_extract_epi64(acc, 0) + _mm256_extract_epi64(acc, 1) +
+                                         _mm256_extract_epi64(acc, 2) + _mm256_extract_epi64(acc, 3));
+#endif
+            for (; i < count; ++i)
+                total += static_cast<size_t>(std::popcount(words[i]));
+            return total;
+        }
+
+        // Index of the first non-zero word at or after start, or count if none
+        inline size_t BitsFindNonZero(const uint64_t *words, size_t start, size_t count) noexcept
+        {
+            size_t i = start;
+#if defined(SFTL_SIMD_AVX2)
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words + i));
+                if (!_mm256_testz_si256(v, v))
+                    break;
+            }
+#elif defined(SFTL_SIMD_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            for (; i + 2 <= count; i += 2)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(words + i));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)) != 0xFFFF)
+                    break;
+            }
+#endif
+            for (; i < count; ++i)
+            {
+                if (words[i])
+                    return i;
+            }
+            return count;
+        }
+
+        // True if any word of a & b is non-zero
+        inline bool BitsIntersect(const uint64_t *a, const uint64_t *b, size_t words) noexcept
+        {
+            size_t i = 0;
+#if defined(SFTL_SIMD_AVX2)
+            for (; i + 4 <= words; i += 4)
+            {
+                const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+                const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+                if (!_mm256_testz_si256(va, vb))
+                    return true;
+            }
+#elif defined(SFTL_SIMD_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            for (; i + 2 <= words; i += 2)
+            {
+                const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+                const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(va, vb), zero)) != 0xFFFF)
+                    return true;
+            }
+#endif
+            for (; i < words; ++i)
+            {
+                if (a[i] & b[i])
+                    return true;
+            }
+            return false;
+        }
+
+        // True if a has no bit that b lacks (a & ~b == 0)
+        inline bool BitsSubset(const uint64_t *a, const uint64_t *b, size_t words) noexcept
+        {
+            size_t i = 0;
+#if defined(SFTL_SIMD_AVX2)
+            for (; i + 4 <= words; i += 4)
+            {
+                const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+                const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+                if (!_mm256_testc_si256(vb, va))
+                    return false;
+            }
+#elif defined(SFTL_SIMD_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            for (; i + 2 <= words; i += 2)
+            {
+                const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+                const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_andnot_si128(vb, va), zero)) != 0xFFFF)
+                    return false;
+            }
+#endif
+            for (; i < words; ++i)
+            {
+                if (a[i] & ~b[i])
+                    return false;
+            }
+            return true;
+        }
+    }
+
+    /**
+     * @brief Resizable bitset for large flag sets and set queries.
+     *
+     * Bulk operations (and/or/xor/andnot, popcount, searches) run over whole
+     * words with SSE2/AVX2 when available. Bits past size() are always zero.
+     * Binary operations between bitsets of different sizes treat the missing
+     * bits of the shorter operand as zero; |= and ^= grow to the larger size.
+     */
+    class DynamicBitset
+    {
+    public:
+        using Word = uint64_t;
+        static constexpr size_t WordBits = 64;
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        /**
+         * @brief Range over the indices of set bits, in increasing order.
+         */
+        class SetBits
+        {
+        public:
+            class iterator
+            {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = size_t;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const size_t *;
+                using reference = size_t;
+
+                iterator(const DynamicBitset *bits, size_t index) noexcept : bits_(bits), index_(index) {}
+
+                size_t operator*() const noexcept { return index_; }
+
+                iterator &operator++() noexcept
+                {
+                    index_ = bits_->find_next(index_);
+                    return *this;
+                }
+
+                bool operator==(const iterator &other) const noexcept { return index_ == other.index_; }
+                bool operator!=(const iterator &other) const noexcept { return index_ != other.index_; }
+
+            private:
+                const DynamicBitset *bits_;
+                size_t index_;
+            };
+
+            explicit SetBits(const DynamicBitset &bits) noexcept : bits_(&bits) {}
+
+            iterator begin() const noexcept { return iterator(bits_, bits_->find_first()); }
+            iterator end() const noexcept { return iterator(bits_, npos); }
+
+        private:
+            const DynamicBitset *bits_;
+        };
+
+        DynamicBitset() = default;
+
+        explicit DynamicBitset(size_t bitCount, bool value = false)
+        {
+            resize(bitCount, value);
+        }
+
+        DynamicBitset(const DynamicBitset &other) = default;
+        DynamicBitset(DynamicBitset &&other) noexcept = default;
+        DynamicBitset &operator=(const DynamicBitset &other) = default;
+        DynamicBitset &operator=(DynamicBitset &&other) noexcept = default;
+
+        size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+        size_t word_count() const noexcept { return words_.size(); }
+        const Word *words() const noexcept { return words_.data(); }
+
+        void resize(size_t bitCount, bool value = false)
+        {
+            const size_t oldSize = size_;
+            words_.resize(WordsFor(bitCount), Word(0));
+            size_ = bitCount;
+
+            if (value && bitCount > oldSize)
+            {
+                // Fill the tail of the old last word, then whole words
+                for (size_t i = oldSize; i < bitCount && (i % WordBits) != 0; ++i)
+                    words_[i / WordBits] |= Word(1) << (i % WordBits);
+                for (size_t w = (oldSize + WordBits - 1) / WordBits; w < words_.size(); ++w)
+                    words_[w] = ~Word(0);
+            }
+
+            ClearUnusedBits();
+        }
+
+        void clear() noexcept
+        {
+            words_.clear();
+            size_ = 0;
+        }
+
+        bool test(size_t index) const noexcept
+        {
+            assert(index < size_);
+            return (words_[index / WordBits] >> (index % WordBits)) & 1;
+        }
+
+        bool operator[](size_t index) const noexcept { return test(index); }
+
+        DynamicBitset &set(size_t index, bool value = true) noexcept
+        {
+            assert(index < size_);
+            const Word mask = Word(1) << (index % WordBits);
+            if (value)
+                words_[index / WordBits] |= mask;
+            else
+                words_[index / WordBits] &= ~mask;
+            return *this;
+        }
+
+        DynamicBitset &set() noexcept
+        {
+            for (Word &word : words_)
+                word = ~Word(0);
+            ClearUnusedBits();
+            return *this;
+        }
+
+        DynamicBitset &reset(size_t index) noexcept { return set(index, false); }
+
+        DynamicBitset &reset() noexcept
+        {
+            for (Word &word : words_)
+                word = 0;
+            return *this;
+        }
+
+        DynamicBitset &flip(size_t index) noexcept
+        {
+            assert(index < size_);
+            words_[index / WordBits] ^= Word(1) << (index % WordBits);
+            return *this;
+        }
+
+        DynamicBitset &flip() noexcept
+        {
+            for (Word &word : words_)
+                word = ~word;
+            ClearUnusedBits();
+            return *this;
+        }
+
+        size_t count() const noexcept { return Detail::BitsPopCount(words_.data(), words_.size()); }
+        bool any() const noexcept { return Detail::BitsFindNonZero(words_.data(), 0, words_.size()) != words_.size(); }
+        bool none() const noexcept { return !any(); }
+        bool all() const noexcept { return count() == size_; }
+
+        /**
+         * @brief Index of the first set bit, or npos.
+         */
+        size_t find_first() const noexcept
+        {
+            const size_t word = Detail::BitsFindNonZero(words_.data(), 0, words_.size());
+            if (word == words_.size())
+                return npos;
+            return word * WordBits + static_cast<size_t>(std::countr_zero(words_[word]));
+        }
+
+        /**
+         * @brief Index of the first set bit after index, or npos.
+         */
+        size_t find_next(size_t index) const noexcept
+        {
+            ++index;
+            if (index >= size_)
+                return npos;
+
+            size_t word = index / WordBits;
+            const Word rest = words_[word] & (~Word(0) << (index % WordBits));
+            if (rest)
+                return word * WordBits + static_cast<size_t>(std::countr_zero(rest));
+
+            word = Detail::BitsFindNonZero(words_.data(), word + 1, words_.size());
+            if (word == words_.size())
+                return npos;
+            return word * WordBits + static_cast<size_t>(std::countr_zero(words_[word]));
+        }
+
+        /**
+         * @brief Calls func(index) for every set bit, in increasing order.
+         */
+        template <typename Func>
+        void for_each_set(Func &&func) const
+        {
+            for (size_t w = 0; w < words_.size(); ++w)
+            {
+                for (Word word = words_[w]; word; word &= word - 1)
+                    func(w * WordBits + static_cast<size_t>(std::countr_zero(word)));
+            }
+        }
+
+        SetBits set_bits() const noexcept { return SetBits(*this); }
+
+        DynamicBitset &operator&=(const DynamicBitset &other) noexcept
+        {
+            const size_t common = MinWords(other);
+            Detail::BitsAnd(words_.data(), other.words_.data(), common);
+            for (size_t w = common; w < words_.size(); ++w)
+                words_[w] = 0;
+            return *this;
+        }
+
+        DynamicBitset &operator|=(const DynamicBitset &other)
+        {
+            if (other.size_ > size_)
+                resize(other.size_);
+            Detail::BitsOr(words_.data(), other.words_.data(), other.words_.size());
+            return *this;
+        }
+
+        DynamicBitset &operator^=(const DynamicBitset &other)
+        {
+            if (other.size_ > size_)
+                resize(other.size_);
+            Detail::BitsXor(words_.data(), other.words_.data(), other.words_.size());
+            return *this;
+        }
+
+        /**
+         * @brief Clears every bit that is set in other (this &= ~other).
+         */
+        DynamicBitset &and_not(const DynamicBitset &other) noexcept
+        {
+            Detail::BitsAndNot(words_.data(), other.words_.data(), MinWords(other));
+            return *this;
+        }
+
+        /**
+         * @brief True if this and other share at least one set bit.
+         */
+        bool intersects(const DynamicBitset &other) const noexcept
+        {
+            return Detail::BitsIntersect(words_.data(), other.words_.data(), MinWords(other));
+        }
+
+        /**
+         * @brief True if every bit set here is also set in other.
+         */
+        bool is_subset_of(const DynamicBitset &other) const noexcept
+        {
+            const size_t common = MinWords(other);
+            if (!Detail::BitsSubset(words_.data(), other.words_.data(), common))
+                return false;
+            return Detail::BitsFindNonZero(words_.data(), common, words_.size()) == words_.size();
+        }
+
+        friend DynamicBitset operator&(DynamicBitset a, const DynamicBitset &b) { return a &= b; }
+        friend DynamicBitset operator|(DynamicBitset a, const DynamicBitset &b) { return a |= b; }
+        friend DynamicBitset operator^(DynamicBitset a, const DynamicBitset &b) { return a ^= b; }
+
+        friend bool operator==(const DynamicBitset &a, const DynamicBitset &b) noexcept
+        {
+            return a.size_ == b.size_ && a.words_ == b.words_;
+        }
+
+        friend bool operator!=(const DynamicBitset &a, const DynamicBitset &b) noexcept { return !(a == b); }
+
+    private:
+        static constexpr size_t WordsFor(size_t bits) noexcept { return (bits + WordBits - 1) / WordBits; }
+
+        size_t MinWords(const DynamicBitset &other) const noexcept
+        {
+            return words_.size() < other.words_.size() ? words_.size() : other.words_.size();
+        }
+
+        void ClearUnusedBits() noexcept
+        {
+            if (size_ % WordBits)
+                words_.back() &= (Word(1) << (size_ % WordBits)) - 1;
+        }
+
+        DynamicArray<Word> words_;
+        size_t size_ = 0;
+    };
+}
@@ -35,11 +35,22 @@
 
 #include <string>
 #include <sstream>
-#include <iomanip>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <algorithm>
+#include <array>
 #include <type_traits>
 #include <cstdio>
+#include <cstdint>
 #include <memory>
 #include <cmath>
+#include <chrono>
+#include <iterator>
+#include <span>
+
+#include <TemplateLibrary/Charconv.hpp>
 
 // std::format but not shit
 namespace SFTL
@@ -55,313 +66,1039 @@ namespace SFTL
             return size;
         }
 
-        // Format using snprintf (faster than streams, works everywhere)
+        // Format using snprintf, only kept for FormatPrintf
         template <typename... Args>
         inline std::string FormatImpl(const char *fmt, Args &&...args)
         {
-            int size = GetFormattedSize(fmt, std::forward<Args>(args)...);
+            // Most results fit on the stack, only longer ones are formatted a second time
+            char buffer[256];
+            const int size = std::snprintf(buffer, sizeof(buffer), fmt, args...);
             if (size < 0)
                 return ""; // Error
+            if (static_cast<size_t>(size) < sizeof(buffer))
+                return std::string(buffer, size);
 
             // +1 for null terminator
-            std::string result(size + 1, '\0');
-            std::snprintf(&result[0], size + 1, fmt, std::forward<Args>(args)...);
+            std::string result(static_cast<size_t>(size) + 1, '\0');
+            if (std::snprintf(result.data(), result.size(), fmt, args...) != size)
+                return "";
             result.resize(size); // Remove null terminator
 
             return result;
         }
+    }
 
-        // Stream-based fallback for non-POD types
-        template <typename T>
-        inline std::string ToString(const T &value)
+    // Type-safe formatting with precision control
+    namespace Fmt
+    {
+        // Fixed precision floating point
+        struct Fixed
+        {
+            double value;
+            int precision;
+
+            Fixed(double v, int p = 3) : value(v), precision(p) {}
+            Fixed(float v, int p = 3) : value(v), precision(p) {}
+        };
+
+        // Scientific notation
+        struct Scientific
+        {
+            double value;
+            int precision;
+
+            Scientific(double v, int p = 3) : value(v), precision(p) {}
+            Scientific(float v, int p = 3) : value(v), precision(p) {}
+        };
+
+        // Hexadecimal
+        struct Hex
+        {
+            unsigned long long value;
+            bool uppercase;
+            bool prefix;
+
+            Hex(unsigned long long v, bool upper = false, bool pre = true)
+                : value(v), uppercase(upper), prefix(pre) {}
+
+            template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+            Hex(T v, bool upper = false, bool pre = true)
+                : value(static_cast<unsigned long long>(v)), uppercase(upper), prefix(pre) {}
+        };
+
+        // Binary representation
+        struct Binary
+        {
+            unsigned long long value;
+            bool prefix;
+
+            Binary(unsigned long long v, bool pre = true)
+                : value(v), prefix(pre) {}
+
+            template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+            Binary(T v, bool pre = true)
+                : value(static_cast<unsigned long long>(v)), prefix(pre) {}
+        };
+
+        // Width and padding
+        struct Padded
+        {
+            std::string value;
+            size_t width;
+            char fillChar;
+            bool leftAlign;
+
+            Padded(const std::string &v, size_t w, char fill = ' ', bool left = false)
+                : value(v), width(w), fillChar(fill), leftAlign(left) {}
+        };
+    }
+
+    template <typename... Args>
+    struct FormatString;
+
+    // String builder for efficient concatenation. Text goes into a growable buffer whose
+    // first InlineCapacity bytes live inside the builder, numbers are written with
+    // std::to_chars so no stream or locale is involved.
+    class StringBuilder
+    {
+    public:
+        static constexpr size_t InlineCapacity = 256;
+
+        StringBuilder() = default;
+
+        explicit StringBuilder(size_t capacity)
         {
-            std::ostringstream oss;
-            oss << value;
-            return oss.str();
+            Reserve(capacity);
         }
 
-        // Specializations for common types with formatting control
-        inline std::string ToString(float value, int precision = 6)
+        StringBuilder(const StringBuilder &other)
         {
-            return FormatImpl("%.*f", precision, value);
+            AppendRaw(other.data_, other.size_);
         }
 
-        inline std::string ToString(double value, int precision = 6)
+        StringBuilder(StringBuilder &&other) noexcept
         {
-            return FormatImpl("%.*f", precision, value);
+            MoveFrom(other);
         }
 
-        inline std::string ToString(long double value, int precision = 6)
+        StringBuilder &operator=(const StringBuilder &other)
         {
-            return FormatImpl("%.*Lf", precision, value);
+            if (this != &other)
+            {
+                size_ = 0;
+                AppendRaw(other.data_, other.size_);
+            }
+            return *this;
+        }
+
+        StringBuilder &operator=(StringBuilder &&other) noexcept
+        {
+            if (this != &other)
+            {
+                ReleaseHeap();
+                MoveFrom(other);
+            }
+            return *this;
+        }
+
+        ~StringBuilder()
+        {
+            ReleaseHeap();
+        }
+
+        template <typename T>
+        StringBuilder &Append(const T &value)
+        {
+            if constexpr (std::is_same_v<T, bool>)
+                AppendRaw(value ? std::string_view("true") : std::string_view("false"));
+            else if constexpr (std::is_same_v<T, char>)
+                AppendRaw(&value, 1);
+            else if constexpr (std::is_integral_v<T>)
+            {
+                Reserve(size_ + MaxIntegerChars<T>);
+                size_ = static_cast<size_t>(WriteInteger(data_ + size_, value) - data_);
+            }
+            else if constexpr (std::is_convertible_v<const T &, std::string_view>)
+                AppendRaw(std::string_view(value));
+            else if constexpr (std::is_floating_point_v<T>)
+                Append(static_cast<double>(value));
+            else
+            {
+                // Types that only know how to print themselves to a stream
+                std::ostringstream oss;
+                oss << value;
+                AppendRaw(oss.str());
+            }
+            return *this;
         }
 
-        inline std::string ToString(int value)
+        StringBuilder &Append(const char *value)
         {
-            return FormatImpl("%d", value);
+            if (value)
+                AppendRaw(std::string_view(value));
+            return *this;
         }
 
-        inline std::string ToString(long value)
+        // Fixed notation with precision digits, a negative precision gives the shortest round-trip text
+        StringBuilder &Append(float value, int precision = 6)
         {
-            return FormatImpl("%ld", value);
+            if (precision < 0)
+                return AppendShortest(value);
+            return AppendFloat(value, std::chars_format::fixed, precision);
         }
 
-        inline std::string ToString(long long value)
+        StringBuilder &Append(double value, int precision = 6)
         {
-            return FormatImpl("%lld", value);
+            if (precision < 0)
+                return AppendShortest(value);
+            return AppendFloat(value, std::chars_format::fixed, precision);
         }
 
-        inline std::string ToString(unsigned int value)
+        StringBuilder &Append(const Fmt::Fixed &f)
         {
-            return FormatImpl("%u", value);
+            return AppendFloat(f.value, std::chars_format::fixed, f.precision);
         }
 
-        inline std::string ToString(unsigned long value)
+        StringBuilder &Append(const Fmt::Scientific &s)
         {
-            return FormatImpl("%lu", value);
+            return AppendFloat(s.value, std::chars_format::scientific, s.precision);
         }
 
-        inline std::string ToString(unsigned long long value)
+        StringBuilder &Append(const Fmt::Hex &h)
         {
-            return FormatImpl("%llu", value);
+            if (h.prefix)
+                AppendRaw("0x", 2);
+
+            const size_t start = size_;
+            AppendChars(16, [&](char *first, char *last)
+                        { return std::to_chars(first, last, h.value, 16); });
+
+            if (h.uppercase)
+            {
+                for (size_t i = start; i < size_; ++i)
+                {
+                    if (data_[i] >= 'a' && data_[i] <= 'f')
+                        data_[i] = static_cast<char>(data_[i] - 'a' + 'A');
+                }
+            }
+            return *this;
         }
 
-        inline std::string ToString(const char *value)
+        StringBuilder &Append(const Fmt::Binary &b)
         {
-            return value ? std::string(value) : "";
+            if (b.prefix)
+                AppendRaw("0b", 2);
+
+            AppendChars(64, [&](char *first, char *last)
+                        { return std::to_chars(first, last, b.value, 2); });
+            return *this;
         }
 
-        inline std::string ToString(const std::string &value)
+        StringBuilder &Append(const Fmt::Padded &p)
         {
-            return value;
+            if (p.value.length() < p.width)
+            {
+                const size_t padding = p.width - p.value.length();
+                if (p.leftAlign)
+                {
+                    AppendRaw(p.value);
+                    AppendFill(p.fillChar, padding);
+                }
+                else
+                {
+                    AppendFill(p.fillChar, padding);
+                    AppendRaw(p.value);
+                }
+                return *this;
+            }
+
+            AppendRaw(p.value);
+            return *this;
         }
 
-        inline std::string ToString(bool value)
+        /**
+         * @brief Appends a {} format string, see SFTL::Format.
+         */
+        template <typename... Args>
+        StringBuilder &AppendFormat(FormatString<std::type_identity_t<Args>...> fmt, const Args &...args);
+
+        template <typename T>
+        StringBuilder &operator<<(const T &value)
         {
-            return value ? "true" : "false";
+            return Append(value);
         }
 
-        inline std::string ToString(char value)
+        /**
+         * @brief Makes room for at least capacity characters in total.
+         */
+        void Reserve(size_t capacity)
         {
-            return std::string(1, value);
+            if (capacity > capacity_)
+                Grow(capacity);
         }
-    }
 
-    // Simple format function that works everywhere
-    // Usage: Format("Value: %d, Name: %s", 42, "test")
-    template <typename... Args>
-    inline std::string Format(const char *fmt, Args &&...args)
-    {
-        return Detail::FormatImpl(fmt, std::forward<Args>(args)...);
-    }
+        /**
+         * @brief The built text, valid until the next modification of the builder.
+         */
+        std::string_view View() const noexcept
+        {
+            return std::string_view(data_, size_);
+        }
 
-    // Type-safe formatting with precision control
-    namespace Fmt
-    {
-        // Fixed precision floating point
-        struct Fixed
+        std::string ToString() const
         {
-            double value;
-            int precision;
+            return std::string(data_, size_);
+        }
 
-            Fixed(double v, int p = 3) : value(v), precision(p) {}
-            Fixed(float v, int p = 3) : value(v), precision(p) {}
-        };
+        const char *Data() const noexcept { return data_; }
 
-        inline std::string ToString(const Fixed &f)
+        void Clear() noexcept
         {
-            return Detail::FormatImpl("%.*f", f.precision, f.value);
+            size_ = 0;
         }
 
-        // Scientific notation
-        struct Scientific
+        size_t Length() const noexcept
         {
-            double value;
-            int precision;
+            return size_;
+        }
 
-            Scientific(double v, int p = 3) : value(v), precision(p) {}
-            Scientific(float v, int p = 3) : value(v), precision(p) {}
-        };
+        size_t Capacity() const noexcept
+        {
+            return capacity_;
+        }
 
-        inline std::string ToString(const Scientific &s)
+        bool Empty() const noexcept
         {
-            return Detail::FormatImpl("%.*e", s.precision, s.value);
+            return size_ == 0;
         }
 
-        // Hexadecimal
-        struct Hex
+        // Raw output used by the formatter
+        void Write(const char *text, size_t length)
         {
-            unsigned long long value;
-            bool uppercase;
-            bool prefix;
+            AppendRaw(text, length);
+        }
 
-            Hex(unsigned long long v, bool upper = false, bool pre = true)
-                : value(v), uppercase(upper), prefix(pre) {}
+        void Fill(char fill, size_t count)
+        {
+            AppendFill(fill, count);
+        }
 
-            template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
-            Hex(T v, bool upper = false, bool pre = true)
-                : value(static_cast<unsigned long long>(v)), uppercase(upper), prefix(pre) {}
-        };
+    private:
+        char inline_[InlineCapacity];
+        char *data_ = inline_;
+        size_t size_ = 0;
+        size_t capacity_ = InlineCapacity;
 
-        inline std::string ToString(const Hex &h)
+        bool IsInline() const noexcept { return data_ == inline_; }
+
+        void ReleaseHeap() noexcept
         {
-            if (h.prefix)
+            if (!IsInline())
+                delete[] data_;
+
+            data_ = inline_;
+            capacity_ = InlineCapacity;
+            size_ = 0;
+        }
+
+        void MoveFrom(StringBuilder &other) noexcept
+        {
+            if (other.IsInline())
             {
-                return h.uppercase
-                           ? Detail::FormatImpl("0x%llX", h.value)
-                           : Detail::FormatImpl("0x%llx", h.value);
+                std::memcpy(inline_, other.inline_, other.size_);
+                size_ = other.size_;
             }
             else
             {
-                return h.uppercase
-                           ? Detail::FormatImpl("%llX", h.value)
-                           : Detail::FormatImpl("%llx", h.value);
+                // Steal the heap buffer
+                data_ = other.data_;
+                size_ = other.size_;
+                capacity_ = other.capacity_;
+                other.data_ = other.inline_;
+                other.capacity_ = InlineCapacity;
             }
+            other.size_ = 0;
         }
 
-        // Binary representation
-        struct Binary
+        void Grow(size_t required)
         {
-            unsigned long long value;
-            bool prefix;
+            const size_t newCapacity = std::max(required, capacity_ * 2);
+            char *buffer = new char[newCapacity];
+            std::memcpy(buffer, data_, size_);
 
-            Binary(unsigned long long v, bool pre = true)
-                : value(v), prefix(pre) {}
+            if (!IsInline())
+                delete[] data_;
 
-            template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
-            Binary(T v, bool pre = true)
-                : value(static_cast<unsigned long long>(v)), prefix(pre) {}
-        };
+            data_ = buffer;
+            capacity_ = newCapacity;
+        }
 
-        inline std::string ToString(const Binary &b)
+        void AppendRaw(const char *text, size_t length)
         {
-            if (b.value == 0)
-                return b.prefix ? "0b0" : "0";
+            if (size_ + length > capacity_)
+            {
+                // text may be a view of our own contents, which Grow frees
+                if (text >= data_ && text < data_ + capacity_)
+                {
+                    const size_t offset = static_cast<size_t>(text - data_);
+                    Grow(size_ + length);
+                    text = data_ + offset;
+                }
+                else
+                {
+                    Grow(size_ + length);
+                }
+            }
 
-            std::string result;
-            unsigned long long val = b.value;
+            std::memcpy(data_ + size_, text, length);
+            size_ += length;
+        }
 
-            while (val > 0)
+        void AppendRaw(std::string_view text)
+        {
+            AppendRaw(text.data(), text.size());
+        }
+
+        void AppendFill(char fill, size_t count)
+        {
+            if (size_ + count > capacity_)
+                Grow(size_ + count);
+
+            std::memset(data_ + size_, fill, count);
+            size_ += count;
+        }
+
+        // Writes straight into the free space with write(first, last), growing until it fits
+        template <typename Writer>
+        void AppendChars(size_t sizeHint, Writer &&write)
+        {
+            Reserve(size_ + sizeHint);
+            while (true)
             {
-                result = (val & 1 ? '1' : '0') + result;
-                val >>= 1;
+                const std::to_chars_result result = write(data_ + size_, data_ + capacity_);
+                if (result.ec == std::errc())
+                {
+                    size_ = static_cast<size_t>(result.ptr - data_);
+                    return;
+                }
+                Grow(capacity_ * 2);
             }
+        }
 
-            return b.prefix ? "0b" + result : result;
+        template <typename T>
+        StringBuilder &AppendShortest(T value)
+        {
+            Reserve(size_ + MaxShortestFloatChars);
+            size_ = static_cast<size_t>(ToChars(data_ + size_, data_ + capacity_, value).ptr - data_);
+            return *this;
         }
 
-        // Width and padding
-        struct Padded
+        StringBuilder &AppendFloat(double value, std::chars_format format, int precision)
         {
-            std::string value;
-            size_t width;
-            char fillChar;
-            bool leftAlign;
+            AppendChars(32 + static_cast<size_t>(std::max(precision, 0)), [&](char *first, char *last)
+                        { return std::to_chars(first, last, value, format, precision); });
+            return *this;
+        }
+    };
 
-            Padded(const std::string &v, size_t w, char fill = ' ', bool left = false)
-                : value(v), width(w), fillChar(fill), leftAlign(left) {}
-        };
+    namespace Fmt
+    {
+        inline std::string ToString(const Fixed &f)
+        {
+            return StringBuilder().Append(f).ToString();
+        }
+
+        inline std::string ToString(const Scientific &s)
+        {
+            return StringBuilder().Append(s).ToString();
+        }
+
+        inline std::string ToString(const Hex &h)
+        {
+            return StringBuilder().Append(h).ToString();
+        }
+
+        inline std::string ToString(const Binary &b)
+        {
+            return StringBuilder().Append(b).ToString();
+        }
 
         inline std::string ToString(const Padded &p)
         {
-            if (p.value.length() >= p.width)
-                return p.value;
+            return StringBuilder().Append(p).ToString();
+        }
+    }
+
+    namespace Detail
+    {
+        // Stream-based fallback for non-POD types
+        template <typename T>
+        inline std::string ToString(const T &value)
+        {
+            return StringBuilder().Append(value).ToString();
+        }
 
-            size_t padding = p.width - p.value.length();
+        // A negative precision gives the shortest text that reads back to the same value
+        inline std::string ToString(float value, int precision = 6)
+        {
+            return StringBuilder().Append(value, precision).ToString();
+        }
 
-            if (p.leftAlign)
-                return p.value + std::string(padding, p.fillChar);
-            else
-                return std::string(padding, p.fillChar) + p.value;
+        inline std::string ToString(double value, int precision = 6)
+        {
+            return StringBuilder().Append(value, precision).ToString();
+        }
+
+        inline std::string ToString(long double value, int precision = 6)
+        {
+            return FormatImpl("%.*Lf", precision, value);
         }
     }
 
-    // String builder for efficient concatenation
-    class StringBuilder
+    /**
+     * @brief Parsed form of a {:spec} replacement field: [[fill]align][0][width][.precision][type].
+     */
+    struct FormatSpec
     {
-    public:
-        StringBuilder() = default;
+        char fill = ' ';
+        char align = 0;       // '<', '>', '^' or 0 for the type default
+        bool zeroPad = false; // '0' flag, pads numbers with zeros after the sign
+        uint32_t width = 0;
+        int32_t precision = -1;
+        char type = 0; // d x X b o c | f e g | s | p, 0 when omitted
+    };
+
+    namespace Detail
+    {
+        enum class FormatArgKind : uint8_t
+        {
+            Bool,
+            Char,
+            Integer,
+            Float,
+            String,
+            Pointer,
+            Custom
+        };
 
         template <typename T>
-        StringBuilder &Append(const T &value)
+        consteval FormatArgKind GetFormatArgKind()
         {
-            stream_ << value;
-            return *this;
+            using U = std::remove_cvref_t<T>;
+            if constexpr (std::is_same_v<U, bool>)
+                return FormatArgKind::Bool;
+            else if constexpr (std::is_same_v<U, char>)
+                return FormatArgKind::Char;
+            else if constexpr (std::is_integral_v<U>)
+                return FormatArgKind::Integer;
+            else if constexpr (std::is_floating_point_v<U>)
+                return FormatArgKind::Float;
+            else if constexpr (std::is_null_pointer_v<U>)
+                return FormatArgKind::Pointer; // Converts to std::string_view, which would read from null
+            else if constexpr (std::is_convertible_v<const U &, std::string_view>)
+                return FormatArgKind::String;
+            else if constexpr (std::is_pointer_v<U>)
+                return FormatArgKind::Pointer;
+            else
+                return FormatArgKind::Custom;
         }
 
-        StringBuilder &Append(float value, int precision = 6)
+        // Not constexpr on purpose: reaching it during constant evaluation is the compile error
+        inline void FormatStringError(const char *) {}
+
+        // Parses the spec between ':' and '}', returns the position of the closing '}' or nullptr
+        constexpr const char *ParseFormatSpec(const char *it, const char *end, FormatSpec &spec)
         {
-            stream_ << std::fixed << std::setprecision(precision) << value;
-            return *this;
+            auto isAlign = [](char c)
+            { return c == '<' || c == '>' || c == '^'; };
+
+            if (it + 1 < end && isAlign(it[1]) && *it != '{' && *it != '}')
+            {
+                spec.fill = *it;
+                spec.align = it[1];
+                it += 2;
+            }
+            else if (it < end && isAlign(*it))
+            {
+                spec.align = *it++;
+            }
+
+            if (it < end && *it == '0')
+            {
+                spec.zeroPad = true;
+                ++it;
+            }
+
+            while (it < end && *it >= '0' && *it <= '9')
+                spec.width = spec.width * 10 + static_cast<uint32_t>(*it++ - '0');
+
+            if (it < end && *it == '.')
+            {
+                ++it;
+                if (it == end || *it < '0' || *it > '9')
+                    return nullptr;
+
+                spec.precision = 0;
+                while (it < end && *it >= '0' && *it <= '9')
+                    spec.precision = spec.precision * 10 + (*it++ - '0');
+            }
+
+            if (it < end && *it != '}')
+                spec.type = *it++;
+
+            return it < end && *it == '}' ? it : nullptr;
         }
 
-        StringBuilder &Append(double value, int precision = 6)
+        constexpr bool IsSpecValidFor(FormatArgKind kind, const FormatSpec &spec)
         {
-            stream_ << std::fixed << std::setprecision(precision) << value;
-            return *this;
+            const char type = spec.type;
+            switch (kind)
+            {
+            case FormatArgKind::Integer:
+                return spec.precision < 0 && (type == 0 || type == 'd' || type == 'x' || type == 'X' || type == 'b' || type == 'o' || type == 'c');
+            case FormatArgKind::Char:
+                return spec.precision < 0 && (type == 0 || type == 'c' || type == 'd' || type == 'x' || type == 'X');
+            case FormatArgKind::Float:
+                return type == 0 || type == 'f' || type == 'e' || type == 'g';
+            case FormatArgKind::Bool:
+                return spec.precision < 0 && (type == 0 || type == 's');
+            case FormatArgKind::String:
+                return !spec.zeroPad && (type == 0 || type == 's');
+            case FormatArgKind::Pointer:
+                return spec.precision < 0 && (type == 0 || type == 'p');
+            case FormatArgKind::Custom:
+                return !spec.zeroPad && spec.precision < 0 && type == 0;
+            }
+            return false;
         }
 
-        StringBuilder &Append(const Fmt::Fixed &f)
+        // Checks escapes, field syntax, argument count and spec/argument agreement
+        template <typename... Args>
+        consteval void ValidateFormatString(std::string_view text)
         {
-            stream_ << std::fixed << std::setprecision(f.precision) << f.value;
-            return *this;
+            constexpr FormatArgKind kinds[sizeof...(Args) + 1] = {GetFormatArgKind<Args>()..., FormatArgKind::Custom};
+            size_t argIndex = 0;
+
+            const char *it = text.data();
+            const char *end = text.data() + text.size();
+            while (it < end)
+            {
+                if (*it == '}')
+                {
+                    if (it + 1 == end || it[1] != '}')
+                        FormatStringError("unmatched '}' in format string, use '}}' for a literal brace");
+                    it += 2;
+                    continue;
+                }
+
+                if (*it != '{')
+                {
+                    ++it;
+                    continue;
+                }
+
+                if (it + 1 < end && it[1] == '{')
+                {
+                    it += 2;
+                    continue;
+                }
+
+                FormatSpec spec;
+                ++it;
+                if (it < end && *it == ':')
+                    it = ParseFormatSpec(it + 1, end, spec);
+                else if (it == end || *it != '}')
+                    it = nullptr;
+
+                if (!it)
+                    FormatStringError("malformed replacement field, expected {} or {:spec}");
+                if (argIndex >= sizeof...(Args))
+                    FormatStringError("format string has more replacement fields than arguments");
+                if (!IsSpecValidFor(kinds[argIndex], spec))
+                    FormatStringError("format spec does not match the argument type");
+
+                ++argIndex;
+                ++it;
+            }
+
+            if (argIndex != sizeof...(Args))
+                FormatStringError("format string has fewer replacement fields than arguments");
         }
+    }
 
-        StringBuilder &Append(const Fmt::Scientific &s)
+    /**
+     * @brief A {} format string checked against its argument types at compile time.
+     */
+    template <typename... Args>
+    struct FormatString
+    {
+        template <typename S>
+            requires std::is_convertible_v<const S &, std::string_view>
+        consteval FormatString(const S &text)
+            : view(text)
         {
-            stream_ << std::scientific << std::setprecision(s.precision) << s.value;
-            return *this;
+            Detail::ValidateFormatString<std::remove_cvref_t<Args>...>(view);
         }
 
-        StringBuilder &Append(const Fmt::Hex &h)
+        std::string_view view;
+    };
+
+    namespace Detail
+    {
+        // Per-argument scratch space, numbers land in buffer and anything larger in overflow
+        struct FormatScratch
         {
-            stream_ << Fmt::ToString(h);
-            return *this;
-        }
+            char buffer[128];
+            std::string overflow;
+        };
 
-        StringBuilder &Append(const Fmt::Binary &b)
+        template <typename T>
+        std::string_view FormatInteger(T value, const FormatSpec &spec, FormatScratch &scratch)
         {
-            stream_ << Fmt::ToString(b);
-            return *this;
+            int base = 10;
+            if (spec.type == 'x' || spec.type == 'X')
+                base = 16;
+            else if (spec.type == 'b')
+                base = 2;
+            else if (spec.type == 'o')
+                base = 8;
+
+            char *last = base == 10 ? WriteInteger(scratch.buffer, value)
+                                    : std::to_chars(scratch.buffer, scratch.buffer + sizeof(scratch.buffer), value, base).ptr;
+            if (spec.type == 'X')
+            {
+                for (char *c = scratch.buffer; c < last; ++c)
+                {
+                    if (*c >= 'a' && *c <= 'f')
+                        *c = static_cast<char>(*c - 'a' + 'A');
+                }
+            }
+            return std::string_view(scratch.buffer, static_cast<size_t>(last - scratch.buffer));
         }
 
-        StringBuilder &Append(const Fmt::Padded &p)
+        template <typename T>
+        std::string_view FormatFloat(T value, const FormatSpec &spec, FormatScratch &scratch)
         {
-            stream_ << Fmt::ToString(p);
-            return *this;
+            auto convert = [&](char *first, char *last)
+            {
+                switch (spec.type)
+                {
+                case 'f':
+                    return std::to_chars(first, last, value, std::chars_format::fixed, spec.precision < 0 ? 6 : spec.precision);
+                case 'e':
+                    return std::to_chars(first, last, value, std::chars_format::scientific, spec.precision < 0 ? 6 : spec.precision);
+                case 'g':
+                    return std::to_chars(first, last, value, std::chars_format::general, spec.precision < 0 ? 6 : spec.precision);
+                default:
+                    // Shortest text that reads back to the same value
+                    return spec.precision < 0 ? ToChars(first, last, value)
+                                              : std::to_chars(first, last, value, std::chars_format::general, spec.precision);
+                }
+            };
+
+            std::to_chars_result result = convert(scratch.buffer, scratch.buffer + sizeof(scratch.buffer));
+            if (result.ec == std::errc())
+                return std::string_view(scratch.buffer, static_cast<size_t>(result.ptr - scratch.buffer));
+
+            // Large fixed values or precisions
+            scratch.overflow.resize(512 + static_cast<size_t>(std::max(spec.precision, 0)));
+            result = convert(scratch.overflow.data(), scratch.overflow.data() + scratch.overflow.size());
+            scratch.overflow.resize(static_cast<size_t>(result.ptr - scratch.overflow.data()));
+            return scratch.overflow;
         }
 
+        // Renders one argument to text, the caller applies width and alignment
         template <typename T>
-        StringBuilder &operator<<(const T &value)
+        std::string_view FormatArgText(const void *arg, const FormatSpec &spec, FormatScratch &scratch)
         {
-            return Append(value);
+            const T &value = *static_cast<const T *>(arg);
+            constexpr FormatArgKind kind = GetFormatArgKind<T>();
+
+            if constexpr (kind == FormatArgKind::Bool)
+                return value ? std::string_view("true") : std::string_view("false");
+            else if constexpr (kind == FormatArgKind::Char)
+            {
+                if (spec.type == 0 || spec.type == 'c')
+                {
+                    scratch.buffer[0] = value;
+                    return std::string_view(scratch.buffer, 1);
+                }
+                return FormatInteger(static_cast<int>(static_cast<unsigned char>(value)), spec, scratch);
+            }
+            else if constexpr (kind == FormatArgKind::Integer)
+            {
+                if (spec.type == 'c')
+                {
+                    scratch.buffer[0] = static_cast<char>(value);
+                    return std::string_view(scratch.buffer, 1);
+                }
+                return FormatInteger(value, spec, scratch);
+            }
+            else if constexpr (kind == FormatArgKind::Float)
+            {
+                if constexpr (std::is_same_v<T, long double>)
+                    return FormatFloat(static_cast<double>(value), spec, scratch);
+                else
+                    return FormatFloat(value, spec, scratch);
+            }
+            else if constexpr (kind == FormatArgKind::String)
+            {
+                std::string_view text;
+                if constexpr (std::is_pointer_v<T>)
+                    text = value ? std::string_view(value) : std::string_view();
+                else
+                    text = std::string_view(value);
+
+                if (spec.precision >= 0 && static_cast<size_t>(spec.precision) < text.size())
+                    text = text.substr(0, static_cast<size_t>(spec.precision));
+                return text;
+            }
+            else if constexpr (kind == FormatArgKind::Pointer)
+            {
+                scratch.buffer[0] = '0';
+                scratch.buffer[1] = 'x';
+                const auto address = reinterpret_cast<uintptr_t>(static_cast<const void *>(value));
+                char *last = std::to_chars(scratch.buffer + 2, scratch.buffer + sizeof(scratch.buffer), address, 16).ptr;
+                return std::string_view(scratch.buffer, static_cast<size_t>(last - scratch.buffer));
+            }
+            else
+            {
+                // Fmt wrappers and anything StringBuilder can print
+                StringBuilder builder;
+                builder.Append(value);
+                scratch.overflow.assign(builder.View());
+                return scratch.overflow;
+            }
         }
 
-        std::string ToString() const
+        struct FormatArg
         {
-            return stream_.str();
+            const void *value;
+            std::string_view (*text)(const void *, const FormatSpec &, FormatScratch &);
+            FormatArgKind kind;
+        };
+
+        template <typename T>
+        FormatArg MakeFormatArg(const T &value)
+        {
+            return {static_cast<const void *>(&value), &FormatArgText<T>, GetFormatArgKind<T>()};
         }
 
-        void Clear()
+        template <typename Sink>
+        void WriteFormatField(Sink &sink, const FormatArg &arg, const FormatSpec &spec, FormatScratch &scratch)
         {
-            stream_.str("");
-            stream_.clear();
+            std::string_view text = arg.text(arg.value, spec, scratch);
+            if (text.size() >= spec.width)
+            {
+                sink.Write(text.data(), text.size());
+                return;
+            }
+
+            const size_t padding = spec.width - text.size();
+            const bool numeric = arg.kind == FormatArgKind::Integer || arg.kind == FormatArgKind::Float;
+
+            if (spec.zeroPad && spec.align == 0 && numeric)
+            {
+                // Sign first, zeros between sign and digits
+                if (!text.empty() && (text[0] == '-' || text[0] == '+'))
+                {
+                    sink.Write(text.data(), 1);
+                    text.remove_prefix(1);
+                }
+                sink.Fill('0', padding);
+                sink.Write(text.data(), text.size());
+                return;
+            }
+
+            // Numbers right-align by default, everything else left-aligns
+            const char align = spec.align ? spec.align : (numeric ? '>' : '<');
+            const size_t before = align == '>' ? padding : align == '^' ? padding / 2 : 0;
+
+            sink.Fill(spec.fill, before);
+            sink.Write(text.data(), text.size());
+            sink.Fill(spec.fill, padding - before);
         }
 
-        size_t Length() const
+        // Single pass over an already validated format string
+        template <typename Sink>
+        void FormatInto(Sink &sink, std::string_view fmt, const FormatArg *args)
         {
-            return stream_.str().length();
+            FormatScratch scratch;
+            size_t argIndex = 0;
+
+            const char *it = fmt.data();
+            const char *end = fmt.data() + fmt.size();
+            const char *literal = it;
+
+            while (it < end)
+            {
+                const char c = *it;
+                if (c != '{' && c != '}')
+                {
+                    ++it;
+                    continue;
+                }
+
+                sink.Write(literal, static_cast<size_t>(it - literal));
+
+                if (it + 1 < end && it[1] == c)
+                {
+                    // Escaped brace
+                    sink.Write(it, 1);
+                    it += 2;
+                    literal = it;
+                    continue;
+                }
+
+                FormatSpec spec;
+                ++it;
+                if (*it == ':')
+                    it = ParseFormatSpec(it + 1, end, spec);
+
+                WriteFormatField(sink, args[argIndex++], spec, scratch);
+                literal = ++it;
+            }
+
+            sink.Write(literal, static_cast<size_t>(end - literal));
         }
 
-        bool Empty() const
+        template <typename Sink, typename... Args>
+        void FormatArgs(Sink &sink, std::string_view fmt, const Args &...args)
         {
-            return stream_.str().empty();
+            if constexpr (sizeof...(Args) == 0)
+            {
+                FormatInto(sink, fmt, nullptr);
+            }
+            else
+            {
+                const FormatArg formatArgs[] = {MakeFormatArg(args)...};
+                FormatInto(sink, fmt, formatArgs);
+            }
         }
 
-    private:
-        std::ostringstream stream_;
+        struct StdStringSink
+        {
+            std::string &out;
+
+            void Write(const char *text, size_t length) { out.append(text, length); }
+            void Fill(char fill, size_t count) { out.append(count, fill); }
+        };
+
+        // Writes up to the end of a fixed buffer and keeps counting past it
+        struct BufferSink
+        {
+            char *out;
+            char *end;
+            size_t size = 0;
+
+            void Write(const char *text, size_t length)
+            {
+                const size_t room = std::min(length, static_cast<size_t>(end - out));
+                std::memcpy(out, text, room);
+                out += room;
+                size += length;
+            }
+
+            void Fill(char fill, size_t count)
+            {
+                const size_t room = std::min(count, static_cast<size_t>(end - out));
+                std::memset(out, fill, room);
+                out += room;
+                size += count;
+            }
+        };
+
+        template <typename OutputIt>
+        struct IteratorSink
+        {
+            OutputIt out;
+
+            void Write(const char *text, size_t length) { out = std::copy_n(text, length, out); }
+            void Fill(char fill, size_t count) { out = std::fill_n(out, count, fill); }
+        };
+
+        struct CountingSink
+        {
+            size_t size = 0;
+
+            void Write(const char *, size_t length) { size += length; }
+            void Fill(char, size_t count) { size += count; }
+        };
+    }
+
+    /**
+     * @brief Result of FormatTo into a fixed buffer.
+     */
+    struct FormatToResult
+    {
+        char *out;   // One past the last character written
+        size_t size; // Length of the full output, larger than the buffer when it was truncated
     };
 
+    // Formats {} replacement fields, checked at compile time against the argument types.
+    // Usage: Format("Value: {}, Name: {}, Hex: {:x}", 42, "test", 255)
+    // Spec: {:[[fill]align][0][width][.precision][type]}, braces escape as {{ and }}
+    template <typename... Args>
+    inline std::string Format(FormatString<std::type_identity_t<Args>...> fmt, const Args &...args)
+    {
+        std::string result;
+        result.reserve(fmt.view.size() + sizeof...(Args) * 8);
+
+        Detail::StdStringSink sink{result};
+        Detail::FormatArgs(sink, fmt.view, args...);
+        return result;
+    }
+
+    // Formats into a caller-owned buffer without allocating, truncating at capacity. No terminator is written.
+    template <typename... Args>
+    inline FormatToResult FormatTo(char *buffer, size_t capacity, FormatString<std::type_identity_t<Args>...> fmt, const Args &...args)
+    {
+        Detail::BufferSink sink{buffer, buffer + capacity};
+        Detail::FormatArgs(sink, fmt.view, args...);
+        return {sink.out, sink.size};
+    }
+
+    template <typename... Args>
+    inline FormatToResult FormatTo(std::span<char> buffer, FormatString<std::type_identity_t<Args>...> fmt, const Args &...args)
+    {
+        return FormatTo<Args...>(buffer.data(), buffer.size(), fmt, args...);
+    }
+
+    // Formats through an output iterator (back_inserter, stream iterator...), returns the advanced iterator.
+    // Raw pointers are unbounded, pass a size or a span instead.
+    template <typename OutputIt, typename... Args>
+        requires(std::output_iterator<OutputIt, char> && !std::is_pointer_v<OutputIt>)
+    inline OutputIt FormatTo(OutputIt out, FormatString<std::type_identity_t<Args>...> fmt, const Args &...args)
+    {
+        Detail::IteratorSink<OutputIt> sink{std::move(out)};
+        Detail::FormatArgs(sink, fmt.view, args...);
+        return std::move(sink.out);
+    }
+
+    // Number of characters Format would produce, without writing them anywhere
+    template <typename... Args>
+    inline size_t FormattedSize(FormatString<std::type_identity_t<Args>...> fmt, const Args &...args)
+    {
+        Detail::CountingSink sink;
+        Detail::FormatArgs(sink, fmt.view, args...);
+        return sink.size;
+    }
+
+    // printf-style formatting, for format strings only known at run time
+    // Usage: FormatPrintf("Value: %d, Name: %s", 42, "test")
+    template <typename... Args>
+    inline std::string FormatPrintf(const char *fmt, Args &&...args)
+    {
+        return Detail::FormatImpl(fmt, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    StringBuilder &StringBuilder::AppendFormat(FormatString<std::type_identity_t<Args>...> fmt, const Args &...args)
+    {
+        Detail::FormatArgs(*this, fmt.view, args...);
+        return *this;
+    }
+
     // Variadic string builder with separators
     namespace Detail
     {
@@ -411,16 +1148,16 @@ namespace SFTL
         if (abs_us >= 1'000'000) // >= 1 second
         {
             double seconds = microseconds / 1'000'000.0;
-            return Detail::FormatImpl("%.3fs", seconds);
+            return Format("{:.3f}s", seconds);
         }
         else if (abs_us >= 1'000) // >= 1 millisecond
         {
             double milliseconds = microseconds / 1'000.0;
-            return Detail::FormatImpl("%.3fms", milliseconds);
+            return Format("{:.3f}ms", milliseconds);
         }
         else // < 1 millisecond
         {
-            return Detail::FormatImpl("%lldμs", static_cast<long long>(microseconds));
+            return Format("{}μs", static_cast<long long>(microseconds));
         }
     }
 
@@ -438,15 +1175,15 @@ namespace SFTL
         }
 
         if (unitIndex == 0)
-            return Detail::FormatImpl("%zu%s", bytes, units[0]);
+            return Format("{}{}", bytes, units[0]);
         else
-            return Detail::FormatImpl("%.*f%s", precision, size, units[unitIndex]);
+            return StringBuilder().Append(size, precision).Append(units[unitIndex]).ToString();
     }
 
     // Format percentage
     inline std::string FormatPercent(double value, int precision = 1)
     {
-        return Detail::FormatImpl("%.*f%%", precision, value * 100.0);
+        return StringBuilder().Append(value * 100.0, precision).Append('%').ToString();
     }
 
     // Pad string
@@ -459,4 +1196,4 @@ namespace SFTL
     {
         return Fmt::ToString(Fmt::Padded(str, width, fillChar, true));
     }
-}
\ No newline at end of file
+}
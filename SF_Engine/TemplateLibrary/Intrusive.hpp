@@ -0,0 +1,624 @@
+/******************************************************************************/
+/* Intrusive.hpp                                                              */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include <TemplateLibrary/Dynamic.hpp>
+
+// Intrusive containers: the links live inside the stored objects, so linking
+// never allocates. An object joins several containers by inheriting one hook
+// per container, each distinguished by a tag type:
+//
+//   struct LruTag; struct DirtyTag;
+//   struct Texture : SFTL::IntrusiveListHook<LruTag>, SFTL::IntrusiveListHook<DirtyTag> { ... };
+//   SFTL::IntrusiveList<Texture, LruTag> lru;
+//   SFTL::IntrusiveList<Texture, DirtyTag> dirty;
+//
+// Containers never own their elements; unlink an object before destroying it.
+namespace SFTL
+{
+    /**
+     * @brief Link for IntrusiveList. Inherit once per list the object can be in.
+     */
+    template <typename Tag = void>
+    class IntrusiveListHook
+    {
+    public:
+        IntrusiveListHook() noexcept = default;
+
+        // Copying an object must not copy its links
+        IntrusiveListHook(const IntrusiveListHook &) noexcept {}
+        IntrusiveListHook &operator=(const IntrusiveListHook &) noexcept { return *this; }
+
+        ~IntrusiveListHook()
+        {
+            assert(!IsLinked() && "Object destroyed while still in an IntrusiveList");
+        }
+
+        bool IsLinked() const noexcept { return next_ != nullptr; }
+
+    private:
+        template <typename, typename>
+        friend class IntrusiveList;
+
+        IntrusiveListHook *prev_ = nullptr;
+        IntrusiveListHook *next_ = nullptr;
+    };
+
+    /**
+     * @brief Doubly linked list over objects deriving from IntrusiveListHook<Tag>.
+     *
+     * Every operation is O(1) except Clear(), which unlinks each element.
+     */
+    template <typename T, typename Tag = void>
+    class IntrusiveList
+    {
+        using Hook = IntrusiveListHook<Tag>;
+        static_assert(std::is_base_of_v<Hook, T>, "T must inherit IntrusiveListHook<Tag>");
+
+    public:
+        template <bool Const>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<Const, const T *, T *>;
+            using reference = std::conditional_t<Const, const T &, T &>;
+
+            Iterator() noexcept = default;
+            explicit Iterator(Hook *hook) noexcept : hook_(hook) {}
+
+            reference operator*() const noexcept { return static_cast<reference>(*hook_); }
+            pointer operator->() const noexcept { return static_cast<pointer>(hook_); }
+
+            Iterator &operator++() noexcept
+            {
+                hook_ = hook_->next_;
+                return *this;
+            }
+
+            Iterator operator++(int) noexcept
+            {
+                Iterator copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            Iterator &operator--() noexcept
+            {
+                hook_ = hook_->prev_;
+                return *this;
+            }
+
+            Iterator operator--(int) noexcept
+            {
+                Iterator copy = *this;
+                --*this;
+                return copy;
+            }
+
+            bool operator==(const Iterator &other) const noexcept { return hook_ == other.hook_; }
+            bool operator!=(const Iterator &other) const noexcept { return hook_ != other.hook_; }
+
+        private:
+            friend class IntrusiveList;
+            Hook *hook_ = nullptr;
+        };
+
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        IntrusiveList() noexcept
+        {
+            head_.prev_ = head_.next_ = &head_;
+        }
+
+        ~IntrusiveList()
+        {
+            Clear();
+            head_.prev_ = head_.next_ = nullptr;
+        }
+
+        IntrusiveList(const IntrusiveList &) = delete;
+        IntrusiveList &operator=(const IntrusiveList &) = delete;
+
+        void PushFront(T &value) noexcept { LinkBefore(head_.next_, value); }
+        void PushBack(T &value) noexcept { LinkBefore(&head_, value); }
+
+        /**
+         * @brief Links value before position and returns an iterator to it.
+         */
+        iterator Insert(iterator position, T &value) noexcept
+        {
+            LinkBefore(position.hook_, value);
+            return iterator(static_cast<Hook *>(&value));
+        }
+
+        /**
+         * @brief Unlinks value, which must be in this list.
+         */
+        void Remove(T &value) noexcept
+        {
+            Hook &hook = value;
+            assert(hook.IsLinked());
+
+            hook.prev_->next_ = hook.next_;
+            hook.next_->prev_ = hook.prev_;
+            hook.prev_ = hook.next_ = nullptr;
+            --size_;
+        }
+
+        iterator Erase(iterator position) noexcept
+        {
+            iterator next(position.hook_->next_);
+            Remove(*position);
+            return next;
+        }
+
+        T *PopFront() noexcept
+        {
+            if (Empty())
+                return nullptr;
+
+            T &value = Front();
+            Remove(value);
+            return &value;
+        }
+
+        T *PopBack() noexcept
+        {
+            if (Empty())
+                return nullptr;
+
+            T &value = Back();
+            Remove(value);
+            return &value;
+        }
+
+        /**
+         * @brief Moves an element already in this list to the front (LRU touch).
+         */
+        void MoveToFront(T &value) noexcept
+        {
+            Remove(value);
+            PushFront(value);
+        }
+
+        void MoveToBack(T &value) noexcept
+        {
+            Remove(value);
+            PushBack(value);
+        }
+
+        /**
+         * @brief Unlinks every element.
+         */
+        void Clear() noexcept
+        {
+            for (Hook *hook = head_.next_; hook != &head_;)
+            {
+                Hook *next = hook->next_;
+                hook->prev_ = hook->next_ = nullptr;
+                hook = next;
+            }
+
+            head_.prev_ = head_.next_ = &head_;
+            size_ = 0;
+        }
+
+        T &Front() noexcept
+        {
+            assert(!Empty());
+            return static_cast<T &>(*head_.next_);
+        }
+
+        T &Back() noexcept
+        {
+            assert(!Empty());
+            return static_cast<T &>(*head_.prev_);
+        }
+
+        const T &Front() const noexcept
+        {
+            assert(!Empty());
+            return static_cast<const T &>(*head_.next_);
+        }
+
+        const T &Back() const noexcept
+        {
+            assert(!Empty());
+            return static_cast<const T &>(*head_.prev_);
+        }
+
+        bool Empty() const noexcept { return size_ == 0; }
+        size_t Size() const noexcept { return size_; }
+
+        iterator begin() noexcept { return iterator(head_.next_); }
+        iterator end() noexcept { return iterator(&head_); }
+        const_iterator begin() const noexcept { return const_iterator(head_.next_); }
+        const_iterator end() const noexcept { return const_iterator(const_cast<Hook *>(&head_)); }
+
+        /**
+         * @brief Gets an iterator to an element known to be in this list.
+         */
+        static iterator IteratorTo(T &value) noexcept { return iterator(static_cast<Hook *>(&value)); }
+
+    private:
+        void LinkBefore(Hook *position, T &value) noexcept
+        {
+            Hook &hook = value;
+            assert(!hook.IsLinked() && "Object is already in a list with this tag");
+
+            hook.next_ = position;
+            hook.prev_ = position->prev_;
+            position->prev_->next_ = &hook;
+            position->prev_ = &hook;
+            ++size_;
+        }
+
+        Hook head_; // Sentinel, never exposed as a T
+        size_t size_ = 0;
+    };
+
+    /**
+     * @brief Link for IntrusiveMPSCStack.
+     */
+    template <typename Tag = void>
+    class IntrusiveStackHook
+    {
+    public:
+        IntrusiveStackHook() noexcept = default;
+        IntrusiveStackHook(const IntrusiveStackHook &) noexcept {}
+        IntrusiveStackHook &operator=(const IntrusiveStackHook &) noexcept { return *this; }
+
+    private:
+        template <typename, typename>
+        friend class IntrusiveMPSCStack;
+
+        IntrusiveStackHook *next_ = nullptr;
+    };
+
+    /**
+     * @brief Lock-free stack with many producers and a single consumer.
+     *
+     * Push may be called from any thread. Pop and PopAll must only be called
+     * from one thread at a time, which is what keeps Pop free of ABA issues.
+     * Typical use: free lists handed back from workers, wait queues, deferred deletes.
+     */
+    template <typename T, typename Tag = void>
+    class IntrusiveMPSCStack
+    {
+        using Hook = IntrusiveStackHook<Tag>;
+        static_assert(std::is_base_of_v<Hook, T>, "T must inherit IntrusiveStackHook<Tag>");
+
+    public:
+        /**
+         * @brief A detached chain of elements, most recently pushed first.
+         */
+        class Chain
+        {
+        public:
+            class iterator
+            {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = T *;
+                using reference = T &;
+
+                explicit iterator(Hook *hook) noexcept : hook_(hook), next_(hook ? hook->next_ : nullptr) {}
+
+                T &operator*() const noexcept { return static_cast<T &>(*hook_); }
+                T *operator->() const noexcept { return static_cast<T *>(hook_); }
+
+                // Reads the next link up front so the current element may be recycled inside the loop
+                iterator &operator++() noexcept
+                {
+                    hook_ = next_;
+                    next_ = hook_ ? hook_->next_ : nullptr;
+                    return *this;
+                }
+
+                bool operator==(const iterator &other) const noexcept { return hook_ == other.hook_; }
+                bool operator!=(const iterator &other) const noexcept { return hook_ != other.hook_; }
+
+            private:
+                Hook *hook_;
+                Hook *next_;
+            };
+
+            explicit Chain(Hook *head) noexcept : head_(head) {}
+
+            iterator begin() const noexcept { return iterator(head_); }
+            iterator end() const noexcept { return iterator(nullptr); }
+            bool Empty() const noexcept { return head_ == nullptr; }
+
+        private:
+            Hook *head_;
+        };
+
+        IntrusiveMPSCStack() noexcept = default;
+        IntrusiveMPSCStack(const IntrusiveMPSCStack &) = delete;
+        IntrusiveMPSCStack &operator=(const IntrusiveMPSCStack &) = delete;
+
+        void Push(T &value) noexcept
+        {
+            Hook *hook = &value;
+            Hook *head = head_.load(std::memory_order_relaxed);
+            do
+            {
+                hook->next_ = head;
+            } while (!head_.compare_exchange_weak(head, hook,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief Consumer only. Pops the most recently pushed element.
+         */
+        T *Pop() noexcept
+        {
+            Hook *head = head_.load(std::memory_order_acquire);
+            while (head && !head_.compare_exchange_weak(head, head->next_,
+                                                        std::memory_order_acquire,
+                                                        std::memory_order_acquire))
+            {
+            }
+
+            return head ? static_cast<T *>(head) : nullptr;
+        }
+
+        /**
+         * @brief Consumer only. Detaches every element at once.
+         */
+        Chain PopAll() noexcept
+        {
+            return Chain(head_.exchange(nullptr, std::memory_order_acquire));
+        }
+
+        bool Empty() const noexcept { return head_.load(std::memory_order_relaxed) == nullptr; }
+
+    private:
+        std::atomic<Hook *> head_ = nullptr;
+    };
+
+    /**
+     * @brief Link for IntrusiveHashTable. Caches the element's hash.
+     */
+    template <typename Tag = void>
+    class IntrusiveHashHook
+    {
+    public:
+        IntrusiveHashHook() noexcept = default;
+        IntrusiveHashHook(const IntrusiveHashHook &) noexcept {}
+        IntrusiveHashHook &operator=(const IntrusiveHashHook &) noexcept { return *this; }
+
+        ~IntrusiveHashHook()
+        {
+            assert(!linked_ && "Object destroyed while still in an IntrusiveHashTable");
+        }
+
+        bool IsLinked() const noexcept { return linked_; }
+
+    private:
+        template <typename, typename, typename, typename, typename, typename>
+        friend class IntrusiveHashTable;
+
+        IntrusiveHashHook *next_ = nullptr;
+        size_t hash_ = 0;
+        bool linked_ = false;
+    };
+
+    /**
+     * @brief Chained hash table over objects deriving from IntrusiveHashHook<Tag>.
+     * @tparam KeyOf Functor returning the key of an element: KeyOf{}(const T &) -> const Key &
+     *
+     * Only the bucket array is allocated, and only when the table grows. Keys are unique.
+     */
+    template <typename T, typename Key, typename KeyOf, typename Hash = std::hash<Key>,
+              typename KeyEqual = std::equal_to<Key>, typename Tag = void>
+    class IntrusiveHashTable
+    {
+        using Hook = IntrusiveHashHook<Tag>;
+        static_assert(std::is_base_of_v<Hook, T>, "T must inherit IntrusiveHashHook<Tag>");
+
+    public:
+        explicit IntrusiveHashTable(size_t bucketCount = 16)
+        {
+            Rehash(bucketCount);
+        }
+
+        ~IntrusiveHashTable() { Clear(); }
+
+        IntrusiveHashTable(const IntrusiveHashTable &) = delete;
+        IntrusiveHashTable &operator=(const IntrusiveHashTable &) = delete;
+
+        /**
+         * @brief Links value into the table.
+         * @return false if an element with the same key is already present.
+         */
+        bool Insert(T &value)
+        {
+            Hook &hook = value;
+            assert(!hook.IsLinked() && "Object is already in a hash table with this tag");
+
+            const size_t hash = Hash{}(KeyOf{}(value));
+            if (FindImpl(KeyOf{}(value), hash))
+                return false;
+
+            if (size_ + 1 > buckets_.size())
+                Rehash(buckets_.size() * 2);
+
+            hook.hash_ = hash;
+            hook.linked_ = true;
+            Hook *&bucket = buckets_[hash & (buckets_.size() - 1)];
+            hook.next_ = bucket;
+            bucket = &hook;
+            ++size_;
+            return true;
+        }
+
+        T *Find(const Key &key) const noexcept
+        {
+            Hook *hook = FindImpl(key, Hash{}(key));
+            return hook ? static_cast<T *>(hook) : nullptr;
+        }
+
+        bool Contains(const Key &key) const noexcept { return Find(key) != nullptr; }
+
+        /**
+         * @brief Unlinks value, which must be in this table.
+         */
+        void Remove(T &value) noexcept
+        {
+            Hook &hook = value;
+            assert(hook.IsLinked());
+
+            for (Hook **link = &buckets_[hook.hash_ & (buckets_.size() - 1)]; *link; link = &(*link)->next_)
+            {
+                if (*link == &hook)
+                {
+                    *link = hook.next_;
+                    hook.next_ = nullptr;
+                    hook.linked_ = false;
+                    --size_;
+                    return;
+                }
+            }
+
+            assert(false && "Object not found in its IntrusiveHashTable bucket");
+        }
+
+        /**
+         * @brief Unlinks and returns the element with key, or nullptr.
+         */
+        T *Erase(const Key &key) noexcept
+        {
+            T *value = Find(key);
+            if (value)
+                Remove(*value);
+            return value;
+        }
+
+        void Clear() noexcept
+        {
+            for (Hook *&bucket : buckets_)
+            {
+                for (Hook *hook = bucket; hook;)
+                {
+                    Hook *next = hook->next_;
+                    hook->next_ = nullptr;
+                    hook->linked_ = false;
+                    hook = next;
+                }
+                bucket = nullptr;
+            }
+            size_ = 0;
+        }
+
+        /**
+         * @brief Calls func(T &) for every element, in bucket order.
+         */
+        template <typename Func>
+        void ForEach(Func &&func)
+        {
+            for (Hook *bucket : buckets_)
+            {
+                for (Hook *hook = bucket; hook;)
+                {
+                    Hook *next = hook->next_;
+                    func(static_cast<T &>(*hook));
+                    hook = next;
+                }
+            }
+        }
+
+        /**
+         * @brief Resizes the bucket array to at least bucketCount (rounded up to a power of two).
+         */
+        void Rehash(size_t bucketCount)
+        {
+            size_t count = 1;
+            while (count < bucketCount || count < size_)
+                count <<= 1;
+
+            if (count == buckets_.size())
+                return;
+
+            DynamicArray<Hook *> buckets;
+            buckets.resize(count, nullptr);
+
+            for (Hook *bucket : buckets_)
+            {
+                for (Hook *hook = bucket; hook;)
+                {
+                    Hook *next = hook->next_;
+                    Hook *&target = buckets[hook->hash_ & (count - 1)];
+                    hook->next_ = target;
+                    target = hook;
+                    hook = next;
+                }
+            }
+
+            buckets_ = std::move(buckets);
+        }
+
+        size_t Size() const noexcept { return size_; }
+        bool Empty() const noexcept { return size_ == 0; }
+        size_t BucketCount() const noexcept { return buckets_.size(); }
+
+    private:
+        Hook *FindImpl(const Key &key, size_t hash) const noexcept
+        {
+            for (Hook *hook = buckets_[hash & (buckets_.size() - 1)]; hook; hook = hook->next_)
+            {
+                if (hook->hash_ == hash && KeyEqual{}(KeyOf{}(static_cast<const T &>(*hook)), key))
+                    return hook;
+            }
+            return nullptr;
+        }
+
+        DynamicArray<Hook *> buckets_;
+        size_t size_ = 0;
+    };
+}
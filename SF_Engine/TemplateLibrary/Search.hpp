@@ -0,0 +1,362 @@
+/******************************************************************************/
+/* Search.hpp                                                                 */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <TemplateLibrary/Simd.hpp>
+
+// Linear search and reduction over contiguous ranges. Arithmetic element types
+// take an SSE2/AVX2 path that tests a full vector of elements per iteration;
+// everything else (and the tail of every range) uses the plain scalar loop.
+namespace SFTL
+{
+    /**
+     * @brief Element types the vector search paths handle.
+     */
+    template <typename T>
+    concept SimdSearchable = std::is_arithmetic_v<T> && !std::is_same_v<T, long double> &&
+                             (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+    namespace Detail
+    {
+#if defined(SFTL_SIMD_AVX2)
+        using SearchReg = __m256i;
+
+        inline SearchReg SearchLoad(const void *ptr) noexcept
+        {
+            return _mm256_loadu_si256(static_cast<const __m256i *>(ptr));
+        }
+
+        inline uint32_t SearchMask(SearchReg reg) noexcept
+        {
+            return static_cast<uint32_t>(_mm256_movemask_epi8(reg));
+        }
+
+        template <typename T>
+        SearchReg SearchBroadcast(T value) noexcept
+        {
+            if constexpr (sizeof(T) == 1)
+                return _mm256_set1_epi8(std::bit_cast<char>(value));
+            else if constexpr (sizeof(T) == 2)
+                return _mm256_set1_epi16(std::bit_cast<short>(value));
+            else if constexpr (sizeof(T) == 4)
+                return _mm256_set1_epi32(std::bit_cast<int>(value));
+            else
+                return _mm256_set1_epi64x(std::bit_cast<long long>(value));
+        }
+
+        // Lanes equal to needle become all ones (float lanes compare as floats)
+        template <typename T>
+        SearchReg SearchEqual(SearchReg a, SearchReg b) noexcept
+        {
+            if constexpr (std::is_same_v<T, float>)
+                return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+            else if constexpr (std::is_same_v<T, double>)
+                return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+            else if constexpr (sizeof(T) == 1)
+                return _mm256_cmpeq_epi8(a, b);
+            else if constexpr (sizeof(T) == 2)
+                return _mm256_cmpeq_epi16(a, b);
+            else if constexpr (sizeof(T) == 4)
+                return _mm256_cmpeq_epi32(a, b);
+            else
+                return _mm256_cmpeq_epi64(a, b);
+        }
+#elif defined(SFTL_SIMD_SSE2)
+        using SearchReg = __m128i;
+
+        inline SearchReg SearchLoad(const void *ptr) noexcept
+        {
+            return _mm_loadu_si128(static_cast<const __m128i *>(ptr));
+        }
+
+        inline uint32_t SearchMask(SearchReg reg) noexcept
+        {
+            return static_cast<uint32_t>(_mm_movemask_epi8(reg));
+        }
+
+        template <typename T>
+        SearchReg SearchBroadcast(T value) noexcept
+        {
+            if constexpr (sizeof(T) == 1)
+                return _mm_set1_epi8(std::bit_cast<char>(value));
+            else if constexpr (sizeof(T) == 2)
+                return _mm_set1_epi16(std::bit_cast<short>(value));
+            else if constexpr (sizeof(T) == 4)
+                return _mm_set1_epi32(std::bit_cast<int>(value));
+            else
+                return _mm_set1_epi64x(std::bit_cast<long long>(value));
+        }
+
+        template <typename T>
+        SearchReg SearchEqual(SearchReg a, SearchReg b) noexcept
+        {
+            if constexpr (std::is_same_v<T, float>)
+                return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+            else if constexpr (std::is_same_v<T, double>)
+                return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+            else if constexpr (sizeof(T) == 1)
+                return _mm_cmpeq_epi8(a, b);
+            else if constexpr (sizeof(T) == 2)
+                return _mm_cmpeq_epi16(a, b);
+            else if constexpr (sizeof(T) == 4)
+                return _mm_cmpeq_epi32(a, b);
+            else
+            {
+#if defined(SFTL_SIMD_SSE41)
+                return _mm_cmpeq_epi64(a, b);
+#else
+                // Both 32-bit halves must match
+                const __m128i halves = _mm_cmpeq_epi32(a, b);
+                return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+#endif
+            }
+        }
+#endif
+
+#if defined(SFTL_SIMD_SSE2)
+        inline constexpr size_t SearchRegBytes = sizeof(SearchReg);
+
+        // Vector min/max for the element types that have a native instruction at this ISA level
+        template <typename T>
+        inline constexpr bool HasSimdMinMax =
+            std::is_same_v<T, float> || std::is_same_v<T, double> ||
+            std::is_same_v<T, int16_t> || std::is_same_v<T, uint8_t>
+#if defined(SFTL_SIMD_AVX2) || defined(SFTL_SIMD_SSE41)
+            || std::is_same_v<T, int32_t> || std::is_same_v<T, uint32_t> ||
+            std::is_same_v<T, int8_t> || std::is_same_v<T, uint16_t>
+#endif
+            ;
+
+        template <typename T, bool Max>
+        SearchReg SearchMinMax(SearchReg a, SearchReg b) noexcept
+        {
+#if defined(SFTL_SIMD_AVX2)
+            if constexpr (std::is_same_v<T, float>)
+                return _mm256_castps_si256(Max ? _mm256_max_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b))
+                                               : _mm256_min_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+            else if constexpr (std::is_same_v<T, double>)
+                return _mm256_castpd_si256(Max ? _mm256_max_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b))
+                                               : _mm256_min_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b)));
+            else if constexpr (std::is_same_v<T, int8_t>)
+                return Max ? _mm256_max_epi8(a, b) : _mm256_min_epi8(a, b);
+            else if constexpr (std::is_same_v<T, uint8_t>)
+                return Max ? _mm256_max_epu8(a, b) : _mm256_min_epu8(a, b);
+            else if constexpr (std::is_same_v<T, int16_t>)
+                return Max ? _mm256_max_epi16(a, b) : _mm256_min_epi16(a, b);
+            else if constexpr (std::is_same_v<T, uint16_t>)
+                return Max ? _mm256_max_epu16(a, b) : _mm256_min_epu16(a, b);
+            else if constexpr (std::is_same_v<T, int32_t>)
+                return Max ? _mm256_max_epi32(a, b) : _mm256_min_epi32(a, b);
+            else
+                return Max ? _mm256_max_epu32(a, b) : _mm256_min_epu32(a, b);
+#else
+            if constexpr (std::is_same_v<T, float>)
+                return _mm_castps_si128(Max ? _mm_max_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b))
+                                            : _mm_min_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+            else if constexpr (std::is_same_v<T, double>)
+                return _mm_castpd_si128(Max ? _mm_max_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b))
+                                            : _mm_min_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+            else if constexpr (std::is_same_v<T, uint8_t>)
+                return Max ? _mm_max_epu8(a, b) : _mm_min_epu8(a, b);
+            else if constexpr (std::is_same_v<T, int16_t>)
+                return Max ? _mm_max_epi16(a, b) : _mm_min_epi16(a, b);
+#if defined(SFTL_SIMD_SSE41)
+            else if constexpr (std::is_same_v<T, int8_t>)
+                return Max ? _mm_max_epi8(a, b) : _mm_min_epi8(a, b);
+            else if constexpr (std::is_same_v<T, uint16_t>)
+                return Max ? _mm_max_epu16(a, b) : _mm_min_epu16(a, b);
+            else if constexpr (std::is_same_v<T, int32_t>)
+                return Max ? _mm_max_epi32(a, b) : _mm_min_epi32(a, b);
+            else
+                return Max ? _mm_max_epu32(a, b) : _mm_min_epu32(a, b);
+#else
+            else
+                return a;
+#endif
+#endif
+        }
+#endif
+
+        template <typename T, bool Max>
+        T MinMaxImpl(const T *data, size_t count) noexcept
+        {
+            assert(count > 0);
+            T best = data[0];
+            size_t i = 0;
+
+#if defined(SFTL_SIMD_SSE2)
+            if constexpr (HasSimdMinMax<T>)
+            {
+                constexpr size_t PerReg = SearchRegBytes / sizeof(T);
+                if (count >= PerReg)
+                {
+                    SearchReg acc = SearchLoad(data);
+                    for (i = PerReg; i + PerReg <= count; i += PerReg)
+                        acc = SearchMinMax<T, Max>(acc, SearchLoad(data + i));
+
+                    T lanes[PerReg];
+                    std::memcpy(lanes, &acc, sizeof(acc));
+                    best = lanes[0];
+                    for (size_t lane = 1; lane < PerReg; ++lane)
+                        best = Max ? (lanes[lane] > best ? lanes[lane] : best) : (lanes[lane] < best ? lanes[lane] : best);
+                }
+            }
+#endif
+            for (; i < count; ++i)
+            {
+                if constexpr (Max)
+                    best = data[i] > best ? data[i] : best;
+                else
+                    best = data[i] < best ? data[i] : best;
+            }
+            return best;
+        }
+    }
+
+    /**
+     * @brief Index of the first element equal to value, or count if there is none.
+     */
+    template <typename T>
+    size_t Find(const T *data, size_t count, const T &value) noexcept
+    {
+        size_t i = 0;
+#if defined(SFTL_SIMD_SSE2)
+        if constexpr (SimdSearchable<T>)
+        {
+            constexpr size_t PerReg = Detail::SearchRegBytes / sizeof(T);
+            const Detail::SearchReg needle = Detail::SearchBroadcast(value);
+            for (; i + PerReg <= count; i += PerReg)
+            {
+                const uint32_t mask = Detail::SearchMask(Detail::SearchEqual<T>(Detail::SearchLoad(data + i), needle));
+                if (mask)
+                    return i + Simd::FirstSet(mask) / sizeof(T);
+            }
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            if (data[i] == value)
+                return i;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Number of elements equal to value.
+     */
+    template <typename T>
+    size_t Count(const T *data, size_t count, const T &value) noexcept
+    {
+        size_t matches = 0;
+        size_t i = 0;
+#if defined(SFTL_SIMD_SSE2)
+        if constexpr (SimdSearchable<T>)
+        {
+            constexpr size_t PerReg = Detail::SearchRegBytes / sizeof(T);
+            const Detail::SearchReg needle = Detail::SearchBroadcast(value);
+            size_t matchedBytes = 0;
+            for (; i + PerReg <= count; i += PerReg)
+            {
+                const uint32_t mask = Detail::SearchMask(Detail::SearchEqual<T>(Detail::SearchLoad(data + i), needle));
+                matchedBytes += static_cast<size_t>(std::popcount(mask));
+            }
+            matches = matchedBytes / sizeof(T);
+        }
+#endif
+        for (; i < count; ++i)
+            matches += data[i] == value ? 1 : 0;
+        return matches;
+    }
+
+    /**
+     * @brief Smallest element of a non-empty range. Unspecified if the range holds NaNs.
+     */
+    template <typename T>
+    T Min(const T *data, size_t count) noexcept
+    {
+        return Detail::MinMaxImpl<T, false>(data, count);
+    }
+
+    /**
+     * @brief Largest element of a non-empty range. Unspecified if the range holds NaNs.
+     */
+    template <typename T>
+    T Max(const T *data, size_t count) noexcept
+    {
+        return Detail::MinMaxImpl<T, true>(data, count);
+    }
+
+    /**
+     * @brief True if both ranges hold equal elements (operator== semantics, so NaN != NaN).
+     */
+    template <typename T>
+    bool Equal(const T *a, const T *b, size_t count) noexcept
+    {
+        if constexpr (std::is_integral_v<T> && std::has_unique_object_representations_v<T>)
+        {
+            // Integers compare equal exactly when their bytes do, and memcmp is already vectorised
+            return count == 0 || std::memcmp(a, b, count * sizeof(T)) == 0;
+        }
+        else
+        {
+            size_t i = 0;
+#if defined(SFTL_SIMD_SSE2)
+            if constexpr (SimdSearchable<T>)
+            {
+                constexpr size_t PerReg = Detail::SearchRegBytes / sizeof(T);
+                constexpr uint32_t AllLanes = static_cast<uint32_t>((uint64_t(1) << Detail::SearchRegBytes) - 1);
+                for (; i + PerReg <= count; i += PerReg)
+                {
+                    const uint32_t mask = Detail::SearchMask(Detail::SearchEqual<T>(Detail::SearchLoad(a + i), Detail::SearchLoad(b + i)));
+                    if (mask != AllLanes)
+                        return false;
+                }
+            }
+#endif
+            for (; i < count; ++i)
+            {
+                if (!(a[i] == b[i]))
+                    return false;
+            }
+            return true;
+        }
+    }
+}
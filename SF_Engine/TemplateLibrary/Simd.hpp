@@ -0,0 +1,93 @@
+/******************************************************************************/
+/* Simd.hpp                                                                   */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+// Compile-time SIMD selection shared by SFTL. The instruction sets come from the
+// compiler flags (see SF_ENABLE_AVX2 in SF_Engine/CMakeLists.txt); every vector
+// path has a scalar fallback so other targets still build.
+
+#if defined(__AVX2__)
+#define SFTL_SIMD_AVX2 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SFTL_SIMD_SSE2 1
+#endif
+
+// MSVC has no __SSSE3__/__SSE4_1__ macros; /arch:AVX implies both
+#if defined(__SSSE3__) || defined(__AVX__)
+#define SFTL_SIMD_SSSE3 1
+#endif
+
+#if defined(__SSE4_1__) || defined(__AVX__)
+#define SFTL_SIMD_SSE41 1
+#endif
+
+#if defined(SFTL_SIMD_SSE2)
+#include <immintrin.h>
+#endif
+
+#include <bit>
+#include <cstdint>
+
+// For routines that read whole aligned vectors past the end of a string. An aligned
+// load never crosses a page so it cannot fault, but AddressSanitizer would report it.
+#if defined(__clang__) || defined(__GNUC__)
+#define SFTL_SIMD_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#elif defined(_MSC_VER)
+#define SFTL_SIMD_NO_SANITIZE_ADDRESS __declspec(no_sanitize_address)
+#else
+#define SFTL_SIMD_NO_SANITIZE_ADDRESS
+#endif
+
+namespace SFTL::Simd
+{
+    /**
+     * @brief Widest vector width in bytes the build was compiled for (1 when scalar).
+     */
+    inline constexpr unsigned VectorWidth =
+#if defined(SFTL_SIMD_AVX2)
+        32;
+#elif defined(SFTL_SIMD_SSE2)
+        16;
+#else
+        1;
+#endif
+
+    // Index of the lowest set bit of a movemask result (mask must not be zero)
+    inline unsigned FirstSet(uint32_t mask) noexcept
+    {
+        return static_cast<unsigned>(std::countr_zero(mask));
+    }
+}
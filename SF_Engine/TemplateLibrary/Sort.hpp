@@ -0,0 +1,360 @@
+/******************************************************************************/
+/* Sort.hpp                                                                   */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <TemplateLibrary/Dynamic.hpp>
+#include <UtilityClasses/ThreadPool.hpp>
+
+// Comparison and radix sorts over spans and DynamicArray. Both run on the calling
+// thread by default; passing a ThreadPool in SortOptions splits the work into one
+// task per worker. A parallel sort must not be started from a task of the same pool,
+// the calling thread blocks on the tasks it enqueued.
+namespace SFTL
+{
+    /**
+     * @brief Execution options shared by Sort and RadixSort.
+     */
+    struct SortOptions
+    {
+        // Pool to run on, nullptr sorts on the calling thread
+        SF::Engine::ThreadPool *pool = nullptr;
+
+        // Keep equal elements in their original order (Sort only, RadixSort is always stable)
+        bool stable = false;
+
+        // Below this many elements per task the sort stays single threaded
+        size_t minElementsPerTask = 16384;
+    };
+
+    /**
+     * @brief Key types RadixSort accepts.
+     */
+    template <typename T>
+    concept RadixKey = (std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+    namespace Detail
+    {
+        // Number of tasks worth splitting count elements into
+        inline size_t SortTaskCount(const SortOptions &options, size_t count)
+        {
+            if (!options.pool || options.pool->GetWorkers().empty())
+                return 1;
+
+            const size_t byWorkers = options.pool->GetWorkers().size() + 1;
+            const size_t bySize = count / std::max<size_t>(options.minElementsPerTask, 1);
+            return std::max<size_t>(1, std::min(byWorkers, bySize));
+        }
+
+        // Runs func(0..taskCount-1), task 0 on the calling thread and the rest on the pool
+        template <typename Func>
+        void SortParallelFor(const SortOptions &options, size_t taskCount, Func &&func)
+        {
+            if (taskCount <= 1)
+            {
+                if (taskCount == 1)
+                    func(size_t(0));
+                return;
+            }
+
+            std::vector<std::future<void>> futures;
+            futures.reserve(taskCount - 1);
+            for (size_t task = 1; task < taskCount; ++task)
+                futures.push_back(options.pool->Enqueue([&func, task]
+                                                        { func(task); }));
+
+            func(size_t(0));
+            for (auto &future : futures)
+                future.get();
+        }
+
+        inline size_t SortChunkBegin(size_t count, size_t taskCount, size_t task)
+        {
+            return count * task / taskCount;
+        }
+
+        template <typename T, typename Compare>
+        void SortSerial(std::span<T> data, Compare &comp, bool stable)
+        {
+            if (stable)
+                std::stable_sort(data.begin(), data.end(), comp);
+            else
+                std::sort(data.begin(), data.end(), comp);
+        }
+
+        // Sorts one chunk per task, then merges neighbouring runs in parallel rounds
+        template <typename T, typename Compare>
+        void SortParallel(std::span<T> data, Compare &comp, const SortOptions &options, size_t taskCount)
+        {
+            const size_t count = data.size();
+
+            std::vector<size_t> bounds(taskCount + 1);
+            for (size_t task = 0; task <= taskCount; ++task)
+                bounds[task] = SortChunkBegin(count, taskCount, task);
+
+            SortParallelFor(options, taskCount, [&](size_t task)
+                            { SortSerial(data.subspan(bounds[task], bounds[task + 1] - bounds[task]), comp, options.stable); });
+
+            if constexpr (std::is_default_constructible_v<T> && std::is_move_assignable_v<T>)
+            {
+                // Ping-pong between data and a scratch buffer, std::merge keeps the left run first on ties
+                std::vector<T> scratch(count);
+                T *source = data.data();
+                T *target = scratch.data();
+
+                while (bounds.size() > 2)
+                {
+                    const size_t runs = bounds.size() - 1;
+                    const size_t merges = runs / 2;
+
+                    SortParallelFor(options, (runs + 1) / 2, [&](size_t pair)
+                                    {
+                        const size_t first = bounds[pair * 2];
+                        if (pair == merges)
+                        {
+                            // Odd run out, carry it over unchanged
+                            std::move(source + first, source + bounds[pair * 2 + 1], target + first);
+                            return;
+                        }
+                        const size_t middle = bounds[pair * 2 + 1];
+                        const size_t last = bounds[pair * 2 + 2];
+                        std::merge(std::make_move_iterator(source + first), std::make_move_iterator(source + middle),
+                                   std::make_move_iterator(source + middle), std::make_move_iterator(source + last),
+                                   target + first, comp); });
+
+                    std::vector<size_t> merged;
+                    merged.reserve(runs / 2 + 2);
+                    for (size_t i = 0; i < bounds.size(); i += 2)
+                        merged.push_back(bounds[i]);
+                    if (merged.back() != count)
+                        merged.push_back(count);
+                    bounds = std::move(merged);
+
+                    std::swap(source, target);
+                }
+
+                if (source != data.data())
+                    std::move(source, source + count, data.data());
+            }
+            else
+            {
+                while (bounds.size() > 2)
+                {
+                    const size_t runs = bounds.size() - 1;
+
+                    SortParallelFor(options, runs / 2, [&](size_t pair)
+                                    { std::inplace_merge(data.begin() + bounds[pair * 2], data.begin() + bounds[pair * 2 + 1],
+                                                         data.begin() + bounds[pair * 2 + 2], comp); });
+
+                    std::vector<size_t> merged;
+                    merged.reserve(runs / 2 + 2);
+                    for (size_t i = 0; i < bounds.size(); i += 2)
+                        merged.push_back(bounds[i]);
+                    if (merged.back() != count)
+                        merged.push_back(count);
+                    bounds = std::move(merged);
+                }
+            }
+        }
+
+        // Maps a key to an unsigned integer with the same ordering
+        template <RadixKey K>
+        auto RadixOrderedBits(K key) noexcept
+        {
+            using Bits = std::make_unsigned_t<std::conditional_t<std::is_same_v<K, float>, int32_t,
+                                                                 std::conditional_t<std::is_same_v<K, double>, int64_t, K>>>;
+            constexpr Bits SignBit = Bits(1) << (sizeof(Bits) * 8 - 1);
+
+            const Bits bits = std::bit_cast<Bits>(key);
+            if constexpr (std::is_floating_point_v<K>)
+                return (bits & SignBit) ? Bits(~bits) : Bits(bits | SignBit);
+            else if constexpr (std::is_signed_v<K>)
+                return Bits(bits ^ SignBit);
+            else
+                return bits;
+        }
+
+        template <RadixKey K>
+        inline uint32_t RadixDigit(K key, unsigned pass) noexcept
+        {
+            return static_cast<uint32_t>((RadixOrderedBits(key) >> (pass * 8)) & 0xFF);
+        }
+
+        using RadixHistogram = std::array<size_t, 256>;
+
+        // LSD radix sort, one byte per pass. Values (may be empty) are permuted alongside the keys.
+        template <RadixKey K, typename V>
+        void RadixSortImpl(std::span<K> keys, std::span<V> values, const SortOptions &options)
+        {
+            constexpr unsigned Passes = sizeof(K);
+            constexpr bool HasValues = !std::is_same_v<V, std::nullptr_t>;
+            const size_t count = keys.size();
+            if (count < 2)
+                return;
+
+            std::vector<K> keyScratch(count);
+            std::vector<std::conditional_t<HasValues, V, char>> valueScratch(HasValues ? count : 0);
+
+            K *keySource = keys.data();
+            K *keyTarget = keyScratch.data();
+            [[maybe_unused]] V *valueSource = nullptr;
+            [[maybe_unused]] V *valueTarget = nullptr;
+            if constexpr (HasValues)
+            {
+                valueSource = values.data();
+                valueTarget = valueScratch.data();
+            }
+
+            const size_t taskCount = SortTaskCount(options, count);
+            std::vector<RadixHistogram> histograms(taskCount);
+
+            for (unsigned pass = 0; pass < Passes; ++pass)
+            {
+                SortParallelFor(options, taskCount, [&](size_t task)
+                                {
+                    RadixHistogram &histogram = histograms[task];
+                    histogram.fill(0);
+                    const size_t end = SortChunkBegin(count, taskCount, task + 1);
+                    for (size_t i = SortChunkBegin(count, taskCount, task); i < end; ++i)
+                        ++histogram[RadixDigit(keySource[i], pass)]; });
+
+                // Every key shares this digit, the pass would not move anything
+                RadixHistogram total{};
+                for (const RadixHistogram &histogram : histograms)
+                    for (size_t digit = 0; digit < 256; ++digit)
+                        total[digit] += histogram[digit];
+                if (std::find(total.begin(), total.end(), count) != total.end())
+                    continue;
+
+                // Turn counts into write offsets, tasks in order so equal digits keep their order
+                size_t offset = 0;
+                for (size_t digit = 0; digit < 256; ++digit)
+                {
+                    for (RadixHistogram &histogram : histograms)
+                    {
+                        const size_t bucket = histogram[digit];
+                        histogram[digit] = offset;
+                        offset += bucket;
+                    }
+                }
+
+                SortParallelFor(options, taskCount, [&](size_t task)
+                                {
+                    RadixHistogram &offsets = histograms[task];
+                    const size_t end = SortChunkBegin(count, taskCount, task + 1);
+                    for (size_t i = SortChunkBegin(count, taskCount, task); i < end; ++i)
+                    {
+                        const size_t destination = offsets[RadixDigit(keySource[i], pass)]++;
+                        keyTarget[destination] = keySource[i];
+                        if constexpr (HasValues)
+                            valueTarget[destination] = std::move(valueSource[i]);
+                    } });
+
+                std::swap(keySource, keyTarget);
+                if constexpr (HasValues)
+                    std::swap(valueSource, valueTarget);
+            }
+
+            if (keySource != keys.data())
+            {
+                std::copy(keySource, keySource + count, keys.data());
+                if constexpr (HasValues)
+                    std::move(valueSource, valueSource + count, values.data());
+            }
+        }
+    }
+
+    /**
+     * @brief Sorts data by comp, in parallel when options carries a pool.
+     */
+    template <typename T, typename Compare = std::less<>>
+    void Sort(std::span<T> data, Compare comp = {}, const SortOptions &options = {})
+    {
+        const size_t taskCount = Detail::SortTaskCount(options, data.size());
+        if (taskCount <= 1)
+            Detail::SortSerial(data, comp, options.stable);
+        else
+            Detail::SortParallel(data, comp, options, taskCount);
+    }
+
+    template <typename T, typename Allocator, typename Compare = std::less<>>
+    void Sort(DynamicArray<T, Allocator> &array, Compare comp = {}, const SortOptions &options = {})
+    {
+        Sort(std::span<T>(array.data(), array.size()), std::move(comp), options);
+    }
+
+    /**
+     * @brief Sorts keys ascending. Always stable; floats order -NaN < -inf < ... < -0 < +0 < ... < +inf < +NaN.
+     */
+    template <RadixKey K>
+    void RadixSort(std::span<K> keys, const SortOptions &options = {})
+    {
+        Detail::RadixSortImpl<K, std::nullptr_t>(keys, {}, options);
+    }
+
+    /**
+     * @brief Sorts keys ascending and applies the same permutation to values (typically indices).
+     */
+    template <RadixKey K, typename V>
+    void RadixSort(std::span<K> keys, std::span<V> values, const SortOptions &options = {})
+    {
+        assert(keys.size() == values.size());
+        Detail::RadixSortImpl<K, V>(keys, values, options);
+    }
+
+    template <RadixKey K, typename Allocator>
+    void RadixSort(DynamicArray<K, Allocator> &keys, const SortOptions &options = {})
+    {
+        RadixSort(std::span<K>(keys.data(), keys.size()), options);
+    }
+
+    template <RadixKey K, typename KeyAllocator, typename V, typename ValueAllocator>
+    void RadixSort(DynamicArray<K, KeyAllocator> &keys, DynamicArray<V, ValueAllocator> &values, const SortOptions &options = {})
+    {
+        RadixSort(std::span<K>(keys.data(), keys.size()), std::span<V>(values.data(), values.size()), options);
+    }
+}
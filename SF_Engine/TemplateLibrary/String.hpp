@@ -0,0 +1,541 @@
+/******************************************************************************/
+/* String.hpp                                                                 */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <compare>
+
+#include <TemplateLibrary/Allocators.hpp>
+#include <TemplateLibrary/Intrusive.hpp>
+
+namespace SFTL
+{
+    /**
+     * @brief Owning string with a 23 character inline buffer (libstdc++ keeps 15).
+     *
+     * Same size as std::string on 64-bit targets (32 bytes). Converts implicitly
+     * to std::string_view and can be built from one without an extra copy.
+     */
+    class String
+    {
+    public:
+        using value_type = char;
+        using size_type = size_t;
+        using iterator = char *;
+        using const_iterator = const char *;
+
+        static constexpr size_t InlineCapacity = 23;
+        static constexpr size_t npos = std::string_view::npos;
+
+        String() noexcept
+        {
+            inline_[0] = '\0';
+        }
+
+        String(const char *str)
+            : String(std::string_view(str ? str : ""))
+        {
+        }
+
+        String(const char *str, size_t length)
+            : String(std::string_view(str, length))
+        {
+        }
+
+        String(std::string_view view)
+        {
+            Init(view.data(), view.size());
+        }
+
+        String(const std::string &str)
+            : String(std::string_view(str))
+        {
+        }
+
+        String(size_t count, char ch)
+        {
+            Init(nullptr, count);
+            std::memset(data(), ch, count);
+        }
+
+        String(const String &other)
+        {
+            Init(other.data(), other.size());
+        }
+
+        String(String &&other) noexcept
+        {
+            std::memcpy(static_cast<void *>(this), &other, sizeof(String));
+            other.size_ = 0;
+            other.inline_[0] = '\0';
+        }
+
+        ~String()
+        {
+            if (IsHeap())
+                ::operator delete(heap_.ptr);
+        }
+
+        String &operator=(const String &other)
+        {
+            if (this != &other)
+                assign(other.view());
+            return *this;
+        }
+
+        String &operator=(String &&other) noexcept
+        {
+            if (this != &other)
+            {
+                this->~String();
+                new (this) String(std::move(other));
+            }
+            return *this;
+        }
+
+        String &operator=(std::string_view view)
+        {
+            assign(view);
+            return *this;
+        }
+
+        String &operator=(const char *str)
+        {
+            assign(std::string_view(str ? str : ""));
+            return *this;
+        }
+
+        String &assign(std::string_view view)
+        {
+            // A view into our own buffer already fits and must not be freed by reserve
+            const bool aliases = view.data() >= data() && view.data() < data() + size();
+            if (!aliases)
+                reserve(view.size());
+            std::memmove(data(), view.data(), view.size());
+            SetSize(view.size());
+            return *this;
+        }
+
+        char *data() noexcept { return IsHeap() ? heap_.ptr : inline_; }
+        const char *data() const noexcept { return IsHeap() ? heap_.ptr : inline_; }
+        const char *c_str() const noexcept { return data(); }
+
+        size_t size() const noexcept { return size_ & ~HeapFlag; }
+        size_t length() const noexcept { return size(); }
+        size_t capacity() const noexcept { return IsHeap() ? heap_.capacity : InlineCapacity; }
+        bool empty() const noexcept { return size() == 0; }
+        bool is_inline() const noexcept { return !IsHeap(); }
+
+        std::string_view view() const noexcept { return {data(), size()}; }
+        operator std::string_view() const noexcept { return view(); }
+        std::string str() const { return std::string(view()); }
+
+        char &operator[](size_t index) noexcept
+        {
+            assert(index < size());
+            return data()[index];
+        }
+
+        const char &operator[](size_t index) const noexcept
+        {
+            assert(index < size());
+            return data()[index];
+        }
+
+        char &front() noexcept { return (*this)[0]; }
+        char &back() noexcept { return (*this)[size() - 1]; }
+        const char &front() const noexcept { return (*this)[0]; }
+        const char &back() const noexcept { return (*this)[size() - 1]; }
+
+        iterator begin() noexcept { return data(); }
+        iterator end() noexcept { return data() + size(); }
+        const_iterator begin() const noexcept { return data(); }
+        const_iterator end() const noexcept { return data() + size(); }
+
+        void reserve(size_t newCapacity)
+        {
+            if (newCapacity <= capacity())
+                return;
+
+            // Grow geometrically so repeated appends stay amortised O(1)
+            const size_t grown = capacity() * 2;
+            Reallocate(newCapacity > grown ? newCapacity : grown);
+        }
+
+        void shrink_to_fit()
+        {
+            if (!IsHeap() || heap_.capacity == size())
+                return;
+
+            const size_t length = size();
+            if (length <= InlineCapacity)
+            {
+                char *ptr = heap_.ptr;
+                std::memcpy(inline_, ptr, length + 1);
+                ::operator delete(ptr);
+                size_ = length;
+                return;
+            }
+
+            Reallocate(length);
+        }
+
+        void clear() noexcept { SetSize(0); }
+
+        void resize(size_t newSize, char ch = '\0')
+        {
+            const size_t oldSize = size();
+            reserve(newSize);
+            if (newSize > oldSize)
+                std::memset(data() + oldSize, ch, newSize - oldSize);
+            SetSize(newSize);
+        }
+
+        String &append(std::string_view view)
+        {
+            const size_t oldSize = size();
+            if (oldSize + view.size() > capacity())
+            {
+                // view may point into our own buffer, which reserve would free
+                if (view.data() >= data() && view.data() <= data() + oldSize)
+                {
+                    const size_t offset = static_cast<size_t>(view.data() - data());
+                    reserve(oldSize + view.size());
+                    view = std::string_view(data() + offset, view.size());
+                }
+                else
+                {
+                    reserve(oldSize + view.size());
+                }
+            }
+
+            std::memmove(data() + oldSize, view.data(), view.size());
+            SetSize(oldSize + view.size());
+            return *this;
+        }
+
+        String &append(size_t count, char ch)
+        {
+            resize(size() + count, ch);
+            return *this;
+        }
+
+        void push_back(char ch)
+        {
+            const size_t oldSize = size();
+            if (oldSize == capacity())
+                reserve(oldSize + 1);
+            data()[oldSize] = ch;
+            SetSize(oldSize + 1);
+        }
+
+        void pop_back() noexcept
+        {
+            assert(!empty());
+            SetSize(size() - 1);
+        }
+
+        String &operator+=(std::string_view view) { return append(view); }
+        String &operator+=(const char *str) { return append(std::string_view(str)); }
+        String &operator+=(char ch)
+        {
+            push_back(ch);
+            return *this;
+        }
+
+        size_t find(std::string_view needle, size_t pos = 0) const noexcept { return view().find(needle, pos); }
+        size_t find(char ch, size_t pos = 0) const noexcept { return view().find(ch, pos); }
+        size_t rfind(std::string_view needle, size_t pos = npos) const noexcept { return view().rfind(needle, pos); }
+        bool starts_with(std::string_view prefix) const noexcept { return view().starts_with(prefix); }
+        bool ends_with(std::string_view suffix) const noexcept { return view().ends_with(suffix); }
+        std::string_view substr(size_t pos, size_t count = npos) const { return view().substr(pos, count); }
+
+        friend bool operator==(const String &a, const String &b) noexcept { return a.view() == b.view(); }
+        friend bool operator==(const String &a, std::string_view b) noexcept { return a.view() == b; }
+        friend bool operator==(const String &a, const char *b) noexcept { return a.view() == std::string_view(b); }
+        friend std::strong_ordering operator<=>(const String &a, const String &b) noexcept { return a.view() <=> b.view(); }
+        friend std::strong_ordering operator<=>(const String &a, std::string_view b) noexcept { return a.view() <=> b; }
+
+        friend String operator+(const String &a, std::string_view b)
+        {
+            String result;
+            result.reserve(a.size() + b.size());
+            result.append(a.view()).append(b);
+            return result;
+        }
+
+        friend void swap(String &a, String &b) noexcept
+        {
+            String tmp(std::move(a));
+            a = std::move(b);
+            b = std::move(tmp);
+        }
+
+    private:
+        static constexpr size_t HeapFlag = size_t(1) << (sizeof(size_t) * 8 - 1);
+
+        bool IsHeap() const noexcept { return (size_ & HeapFlag) != 0; }
+
+        void SetSize(size_t newSize) noexcept
+        {
+            assert(newSize <= capacity());
+            size_ = newSize | (size_ & HeapFlag);
+            data()[newSize] = '\0';
+        }
+
+        void Init(const char *str, size_t length)
+        {
+            char *dest = inline_;
+            size_ = length;
+            if (length > InlineCapacity)
+            {
+                dest = static_cast<char *>(::operator new(length + 1));
+                heap_.ptr = dest;
+                heap_.capacity = length;
+                size_ |= HeapFlag;
+            }
+
+            if (str)
+                std::memcpy(dest, str, length);
+            dest[length] = '\0';
+        }
+
+        void Reallocate(size_t newCapacity)
+        {
+            const size_t length = size();
+            char *ptr = static_cast<char *>(::operator new(newCapacity + 1));
+            std::memcpy(ptr, data(), length + 1);
+
+            if (IsHeap())
+                ::operator delete(heap_.ptr);
+
+            heap_.ptr = ptr;
+            heap_.capacity = newCapacity;
+            size_ = length | HeapFlag;
+        }
+
+        struct Heap
+        {
+            char *ptr;
+            size_t capacity; // Excluding the null terminator
+        };
+
+        union
+        {
+            Heap heap_;
+            char inline_[InlineCapacity + 1];
+        };
+        size_t size_ = 0; // Top bit set when the characters live on the heap
+    };
+
+    /**
+     * @brief Global table of unique, immutable strings.
+     *
+     * Split into shards with their own reader/writer lock so concurrent interning
+     * of unrelated strings rarely contends. Interned characters are stored in
+     * per-shard arenas and live until the program exits.
+     */
+    class InternTable
+    {
+    public:
+        static constexpr size_t ShardCount = 16;
+
+        struct Entry : IntrusiveHashHook<>
+        {
+            std::string_view view; // Points just past this header
+        };
+
+        static InternTable &Get()
+        {
+            static InternTable table;
+            return table;
+        }
+
+        /**
+         * @brief Returns the unique entry for str, creating it if needed.
+         */
+        const Entry *Intern(std::string_view str)
+        {
+            const size_t hash = std::hash<std::string_view>{}(str);
+            Shard &shard = shards_[ShardIndex(hash)];
+
+            {
+                std::shared_lock lock(shard.mutex);
+                if (const Entry *entry = shard.table.Find(str))
+                    return entry;
+            }
+
+            std::unique_lock lock(shard.mutex);
+            if (const Entry *entry = shard.table.Find(str))
+                return entry;
+
+            void *memory = shard.storage.Allocate(sizeof(Entry) + str.size() + 1, alignof(Entry));
+            char *chars = static_cast<char *>(memory) + sizeof(Entry);
+            std::memcpy(chars, str.data(), str.size());
+            chars[str.size()] = '\0';
+
+            Entry *entry = new (memory) Entry();
+            entry->view = std::string_view(chars, str.size());
+            shard.table.Insert(*entry);
+            return entry;
+        }
+
+        /**
+         * @brief Returns the entry for str if it has been interned, without creating one.
+         */
+        const Entry *Find(std::string_view str) const
+        {
+            const Shard &shard = shards_[ShardIndex(std::hash<std::string_view>{}(str))];
+            std::shared_lock lock(shard.mutex);
+            return shard.table.Find(str);
+        }
+
+        size_t Size() const
+        {
+            size_t total = 0;
+            for (const Shard &shard : shards_)
+            {
+                std::shared_lock lock(shard.mutex);
+                total += shard.table.Size();
+            }
+            return total;
+        }
+
+    private:
+        struct KeyOf
+        {
+            const std::string_view &operator()(const Entry &entry) const noexcept { return entry.view; }
+        };
+
+        struct Shard
+        {
+            mutable std::shared_mutex mutex;
+            IntrusiveHashTable<Entry, std::string_view, KeyOf> table{64};
+            MonotonicArena storage{16 * 1024};
+
+            // Entries live in the arena for the whole program; just unlink them
+            ~Shard() { table.Clear(); }
+        };
+
+        InternTable() = default;
+
+        static size_t ShardIndex(size_t hash) noexcept
+        {
+            // The low bits pick the bucket inside the shard, so use the high ones here
+            return (hash >> (sizeof(size_t) * 8 - 4)) & (ShardCount - 1);
+        }
+
+        Shard shards_[ShardCount];
+    };
+
+    /**
+     * @brief Handle to a string in the global InternTable.
+     *
+     * Equal strings always share the same storage, so copies, comparison and
+     * hashing only touch a pointer. Use it for names that are compared far more
+     * often than they are created: module names, resource names, log categories.
+     */
+    class InternedString
+    {
+    public:
+        InternedString() noexcept = default;
+
+        explicit InternedString(std::string_view str)
+            : entry_(str.empty() ? nullptr : InternTable::Get().Intern(str))
+        {
+        }
+
+        explicit InternedString(const char *str)
+            : InternedString(std::string_view(str ? str : ""))
+        {
+        }
+
+        /**
+         * @brief Looks up str without interning it. Returns an empty handle if it was never interned.
+         */
+        static InternedString Find(std::string_view str)
+        {
+            InternedString result;
+            if (!str.empty())
+                result.entry_ = InternTable::Get().Find(str);
+            return result;
+        }
+
+        std::string_view view() const noexcept { return entry_ ? entry_->view : std::string_view(); }
+        operator std::string_view() const noexcept { return view(); }
+        const char *c_str() const noexcept { return entry_ ? entry_->view.data() : ""; }
+        size_t size() const noexcept { return view().size(); }
+        bool empty() const noexcept { return entry_ == nullptr; }
+
+        /**
+         * @brief Stable identity of the string for the lifetime of the program.
+         */
+        const void *id() const noexcept { return entry_; }
+
+        friend bool operator==(InternedString a, InternedString b) noexcept { return a.entry_ == b.entry_; }
+        friend bool operator!=(InternedString a, InternedString b) noexcept { return a.entry_ != b.entry_; }
+
+        // Orders by address: fast, stable within a run, not alphabetical
+        friend bool operator<(InternedString a, InternedString b) noexcept { return std::less<const void *>{}(a.entry_, b.entry_); }
+
+    private:
+        const InternTable::Entry *entry_ = nullptr;
+    };
+}
+
+template <>
+struct std::hash<SFTL::String>
+{
+    size_t operator()(const SFTL::String &str) const noexcept
+    {
+        return std::hash<std::string_view>{}(str.view());
+    }
+};
+
+template <>
+struct std::hash<SFTL::InternedString>
+{
+    size_t operator()(SFTL::InternedString str) const noexcept
+    {
+        // Entries are at least 8-byte aligned; drop the always-zero bits
+        return std::hash<const void *>{}(str.id()) >> 3;
+    }
+};
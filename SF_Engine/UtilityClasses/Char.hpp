@@ -1,5 +1,5 @@
 /******************************************************************************/
-/* Char.hpp                                                     */
+/* Char.hpp                                                                   */
 /******************************************************************************/
 /*                            This file is part of                            */
 /*                                SF Game Engine                              */
@@ -31,10 +31,18 @@
 /* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
 /* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
 /******************************************************************************/
+#pragma once
 // UtilityClasses/Char.hpp - A file containing char utilities.
 #include <cstddef>
+#include <cstdint>
+#include <string>
 #include <type_traits>
 
+#include <TemplateLibrary/Simd.hpp>
+
+// The string routines stay constexpr; at runtime they switch to SSE2/AVX2 versions
+// (whichever the build targets, see Simd.hpp) through std::is_constant_evaluated().
+
 namespace SF::Engine
 {
     template <typename T, std::size_t N>
@@ -95,9 +103,193 @@ namespace SF::Engine
         return is_upper(c) ? c + ('a' - 'A') : c;
     }
 
-    // String length (constexpr)
+    namespace detail
+    {
+#if defined(SFTL_SIMD_SSE2)
+        // One vector of bytes at the widest width the build targets
+#if defined(SFTL_SIMD_AVX2)
+        using byte_block = __m256i;
+        inline constexpr std::size_t block_size = 32;
+
+        SFTL_SIMD_NO_SANITIZE_ADDRESS inline byte_block block_load(const char *p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+        SFTL_SIMD_NO_SANITIZE_ADDRESS inline byte_block block_load_aligned(const char *p) noexcept { return _mm256_load_si256(reinterpret_cast<const __m256i *>(p)); }
+        inline byte_block block_splat(char c) noexcept { return _mm256_set1_epi8(c); }
+        inline uint32_t block_equal(byte_block a, byte_block b) noexcept { return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))); }
+
+        inline byte_block block_to_lower(byte_block v) noexcept
+        {
+            // 'A'..'Z' shifted to the bottom of the signed range so one compare finds them
+            const __m256i shifted = _mm256_add_epi8(v, _mm256_set1_epi8(static_cast<char>(128 - 'A')));
+            const __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-128 + 26)), shifted);
+            return _mm256_or_si256(v, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+        }
+#else
+        using byte_block = __m128i;
+        inline constexpr std::size_t block_size = 16;
+
+        SFTL_SIMD_NO_SANITIZE_ADDRESS inline byte_block block_load(const char *p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+        SFTL_SIMD_NO_SANITIZE_ADDRESS inline byte_block block_load_aligned(const char *p) noexcept { return _mm_load_si128(reinterpret_cast<const __m128i *>(p)); }
+        inline byte_block block_splat(char c) noexcept { return _mm_set1_epi8(c); }
+        inline uint32_t block_equal(byte_block a, byte_block b) noexcept { return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))); }
+
+        inline byte_block block_to_lower(byte_block v) noexcept
+        {
+            const __m128i shifted = _mm_add_epi8(v, _mm_set1_epi8(static_cast<char>(128 - 'A')));
+            const __m128i upper = _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(-128 + 26)));
+            return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+        }
+#endif
+        inline constexpr uint32_t block_all = block_size == 32 ? 0xFFFFFFFFu : 0xFFFFu;
+
+        inline const char *align_down(const char *p) noexcept
+        {
+            return reinterpret_cast<const char *>(reinterpret_cast<uintptr_t>(p) & ~uintptr_t(block_size - 1));
+        }
+
+        // Whether an unaligned block load at p stays inside p's page
+        inline bool block_fits_page(const char *p) noexcept
+        {
+            return (reinterpret_cast<uintptr_t>(p) & 4095) <= 4096 - block_size;
+        }
+
+        SFTL_SIMD_NO_SANITIZE_ADDRESS inline std::size_t strlen_runtime(const char *str) noexcept
+        {
+            const byte_block zero = block_splat('\0');
+            const char *block = align_down(str);
+            uint32_t mask = block_equal(block_load_aligned(block), zero) >> (str - block);
+            if (mask)
+                return SFTL::Simd::FirstSet(mask);
+
+            while (true)
+            {
+                block += block_size;
+                mask = block_equal(block_load_aligned(block), zero);
+                if (mask)
+                    return static_cast<std::size_t>(block - str) + SFTL::Simd::FirstSet(mask);
+            }
+        }
+
+        SFTL_SIMD_NO_SANITIZE_ADDRESS inline const char *strchr_runtime(const char *str, char ch) noexcept
+        {
+            const byte_block zero = block_splat('\0');
+            const byte_block wanted = block_splat(ch);
+            const char *block = align_down(str);
+            byte_block v = block_load_aligned(block);
+            uint32_t mask = (block_equal(v, zero) | block_equal(v, wanted)) >> (str - block);
+            if (mask)
+            {
+                const char *found = str + SFTL::Simd::FirstSet(mask);
+                return *found == ch ? found : nullptr;
+            }
+
+            while (true)
+            {
+                block += block_size;
+                v = block_load_aligned(block);
+                mask = block_equal(v, zero) | block_equal(v, wanted);
+                if (mask)
+                {
+                    const char *found = block + SFTL::Simd::FirstSet(mask);
+                    return *found == ch ? found : nullptr;
+                }
+            }
+        }
+
+        inline const char *memchr_runtime(const char *str, char ch, std::size_t count) noexcept
+        {
+            const byte_block wanted = block_splat(ch);
+            const char *last = str + count;
+            for (; static_cast<std::size_t>(last - str) >= block_size; str += block_size)
+            {
+                if (const uint32_t mask = block_equal(block_load(str), wanted))
+                    return str + SFTL::Simd::FirstSet(mask);
+            }
+            for (; str < last; ++str)
+            {
+                if (*str == ch)
+                    return str;
+            }
+            return nullptr;
+        }
+
+        // Compares a block at a time while neither string can run into the next page,
+        // byte by byte across page boundaries. Returns the offset of the first mismatch
+        // or terminator, compared after transform.
+        template <bool CaseInsensitive>
+        SFTL_SIMD_NO_SANITIZE_ADDRESS inline std::size_t mismatch_runtime(const char *s1, const char *s2) noexcept
+        {
+            const byte_block zero = block_splat('\0');
+            std::size_t offset = 0;
+            while (true)
+            {
+                if (block_fits_page(s1 + offset) && block_fits_page(s2 + offset))
+                {
+                    byte_block a = block_load(s1 + offset);
+                    byte_block b = block_load(s2 + offset);
+                    const uint32_t terminators = block_equal(a, zero);
+                    if constexpr (CaseInsensitive)
+                    {
+                        a = block_to_lower(a);
+                        b = block_to_lower(b);
+                    }
+                    const uint32_t mask = (~block_equal(a, b) & block_all) | terminators;
+                    if (mask)
+                        return offset + SFTL::Simd::FirstSet(mask);
+                    offset += block_size;
+                }
+                else
+                {
+                    const char a = s1[offset];
+                    const char b = s2[offset];
+                    if (a == '\0' || (CaseInsensitive ? to_lower(a) != to_lower(b) : a != b))
+                        return offset;
+                    ++offset;
+                }
+            }
+        }
+
+        // Candidate positions are where both the first and the last needle character match,
+        // only those are compared in full
+        inline const char *find_runtime(const char *haystack, std::size_t size, const char *needle, std::size_t length) noexcept
+        {
+            if (length > size)
+                return nullptr;
+            if (length == 1)
+                return memchr_runtime(haystack, needle[0], size);
+
+            const byte_block first = block_splat(needle[0]);
+            const byte_block last = block_splat(needle[length - 1]);
+            const std::size_t end = size - length + 1;
+            std::size_t i = 0;
+            for (; i + block_size <= end; i += block_size)
+            {
+                uint32_t mask = block_equal(block_load(haystack + i), first) &
+                                block_equal(block_load(haystack + i + length - 1), last);
+                while (mask)
+                {
+                    const unsigned bit = SFTL::Simd::FirstSet(mask);
+                    if (std::char_traits<char>::compare(haystack + i + bit + 1, needle + 1, length - 2) == 0)
+                        return haystack + i + bit;
+                    mask &= mask - 1;
+                }
+            }
+            for (; i < end; ++i)
+            {
+                if (haystack[i] == needle[0] && std::char_traits<char>::compare(haystack + i + 1, needle + 1, length - 1) == 0)
+                    return haystack + i;
+            }
+            return nullptr;
+        }
+#endif
+    }
+
+    // String length
     constexpr std::size_t strlen(const char *str) noexcept
     {
+#if defined(SFTL_SIMD_SSE2)
+        if (!std::is_constant_evaluated())
+            return detail::strlen_runtime(str);
+#endif
         std::size_t len = 0;
         while (str[len] != '\0')
             ++len;
@@ -107,6 +299,13 @@ namespace SF::Engine
     // String comparison
     constexpr int strcmp(const char *s1, const char *s2) noexcept
     {
+#if defined(SFTL_SIMD_SSE2)
+        if (!std::is_constant_evaluated())
+        {
+            const std::size_t i = detail::mismatch_runtime<false>(s1, s2);
+            return static_cast<unsigned char>(s1[i]) - static_cast<unsigned char>(s2[i]);
+        }
+#endif
         while (*s1 && (*s1 == *s2))
         {
             ++s1;
@@ -130,6 +329,13 @@ namespace SF::Engine
     // Case-insensitive comparison
     constexpr int stricmp(const char *s1, const char *s2) noexcept
     {
+#if defined(SFTL_SIMD_SSE2)
+        if (!std::is_constant_evaluated())
+        {
+            const std::size_t i = detail::mismatch_runtime<true>(s1, s2);
+            return to_lower(s1[i]) - to_lower(s2[i]);
+        }
+#endif
         while (*s1 && (to_lower(*s1) == to_lower(*s2)))
         {
             ++s1;
@@ -141,6 +347,10 @@ namespace SF::Engine
     // String search
     constexpr const char *strchr(const char *str, char ch) noexcept
     {
+#if defined(SFTL_SIMD_SSE2)
+        if (!std::is_constant_evaluated())
+            return ch == '\0' ? str + detail::strlen_runtime(str) : detail::strchr_runtime(str, ch);
+#endif
         while (*str)
         {
             if (*str == ch)
@@ -150,6 +360,21 @@ namespace SF::Engine
         return ch == '\0' ? str : nullptr;
     }
 
+    // First occurrence of ch in the count characters at str, terminators included
+    constexpr const char *memchr(const char *str, char ch, std::size_t count) noexcept
+    {
+#if defined(SFTL_SIMD_SSE2)
+        if (!std::is_constant_evaluated())
+            return detail::memchr_runtime(str, ch, count);
+#endif
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (str[i] == ch)
+                return str + i;
+        }
+        return nullptr;
+    }
+
     constexpr const char *strrchr(const char *str, char ch) noexcept
     {
         const char *last = nullptr;
@@ -167,6 +392,11 @@ namespace SF::Engine
         if (*needle == '\0')
             return haystack;
 
+#if defined(SFTL_SIMD_SSE2)
+        if (!std::is_constant_evaluated())
+            return detail::find_runtime(haystack, detail::strlen_runtime(haystack), needle, detail::strlen_runtime(needle));
+#endif
+
         for (const char *h = haystack; *h; ++h)
         {
             const char *h_ptr = h;
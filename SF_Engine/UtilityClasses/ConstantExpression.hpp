@@ -5,6 +5,26 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+// Reverse lookup of string ids (id -> name) costs a map and a lock per runtime-created id,
+// so it is only compiled into debug builds unless requested explicitly
+#ifndef SF_STRING_ID_LOOKUP
+#ifdef NDEBUG
+#define SF_STRING_ID_LOOKUP 0
+#else
+#define SF_STRING_ID_LOOKUP 1
+#endif
+#endif
+
+#if SF_STRING_ID_LOOKUP
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#endif
 
 namespace SF::Engine
 {
@@ -126,4 +146,257 @@ namespace SF::Engine
 
     template <typename T>
     static const T &to_reference(const std::unique_ptr<T> &obj) noexcept { return *obj.get(); }
-}
\ No newline at end of file
+
+    namespace detail
+    {
+        inline constexpr uint64_t fnv1a_offset = 0xCBF29CE484222325ull;
+        inline constexpr uint64_t fnv1a_prime = 0x00000100000001B3ull;
+
+        inline constexpr uint64_t xxh64_prime1 = 0x9E3779B185EBCA87ull;
+        inline constexpr uint64_t xxh64_prime2 = 0xC2B2AE3D27D4EB4Full;
+        inline constexpr uint64_t xxh64_prime3 = 0x165667B19E3779F9ull;
+        inline constexpr uint64_t xxh64_prime4 = 0x85EBCA77C2B2AE63ull;
+        inline constexpr uint64_t xxh64_prime5 = 0x27D4EB2F165667C5ull;
+
+        constexpr uint64_t rotl(uint64_t value, int bits) noexcept
+        {
+            return (value << bits) | (value >> (64 - bits));
+        }
+
+        // Little-endian reads that also work during constant evaluation
+        constexpr uint64_t read_u64(const char *p) noexcept
+        {
+            uint64_t value = 0;
+            for (int i = 7; i >= 0; --i)
+                value = (value << 8) | static_cast<unsigned char>(p[i]);
+            return value;
+        }
+
+        constexpr uint64_t read_u32(const char *p) noexcept
+        {
+            uint64_t value = 0;
+            for (int i = 3; i >= 0; --i)
+                value = (value << 8) | static_cast<unsigned char>(p[i]);
+            return value;
+        }
+
+        constexpr uint64_t xxh64_round(uint64_t accumulator, uint64_t input) noexcept
+        {
+            accumulator += input * xxh64_prime2;
+            return rotl(accumulator, 31) * xxh64_prime1;
+        }
+
+        constexpr uint64_t xxh64_merge(uint64_t accumulator, uint64_t lane) noexcept
+        {
+            accumulator ^= xxh64_round(0, lane);
+            return accumulator * xxh64_prime1 + xxh64_prime4;
+        }
+    }
+
+    // 64-bit FNV-1a, cheapest for the short keys it is usually given
+    constexpr uint64_t hash_fnv1a(std::string_view str, uint64_t seed = detail::fnv1a_offset) noexcept
+    {
+        uint64_t hash = seed;
+        for (char c : str)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= detail::fnv1a_prime;
+        }
+        return hash;
+    }
+
+    // XXH64, bit-identical to the reference implementation
+    constexpr uint64_t hash_xxh64(std::string_view str, uint64_t seed = 0) noexcept
+    {
+        const char *p = str.data();
+        const char *end = p + str.size();
+        uint64_t hash;
+
+        if (str.size() >= 32)
+        {
+            uint64_t v1 = seed + detail::xxh64_prime1 + detail::xxh64_prime2;
+            uint64_t v2 = seed + detail::xxh64_prime2;
+            uint64_t v3 = seed;
+            uint64_t v4 = seed - detail::xxh64_prime1;
+            do
+            {
+                v1 = detail::xxh64_round(v1, detail::read_u64(p));
+                v2 = detail::xxh64_round(v2, detail::read_u64(p + 8));
+                v3 = detail::xxh64_round(v3, detail::read_u64(p + 16));
+                v4 = detail::xxh64_round(v4, detail::read_u64(p + 24));
+                p += 32;
+            } while (end - p >= 32);
+
+            hash = detail::rotl(v1, 1) + detail::rotl(v2, 7) + detail::rotl(v3, 12) + detail::rotl(v4, 18);
+            hash = detail::xxh64_merge(hash, v1);
+            hash = detail::xxh64_merge(hash, v2);
+            hash = detail::xxh64_merge(hash, v3);
+            hash = detail::xxh64_merge(hash, v4);
+        }
+        else
+        {
+            hash = seed + detail::xxh64_prime5;
+        }
+
+        hash += static_cast<uint64_t>(str.size());
+
+        for (; end - p >= 8; p += 8)
+        {
+            hash ^= detail::xxh64_round(0, detail::read_u64(p));
+            hash = detail::rotl(hash, 27) * detail::xxh64_prime1 + detail::xxh64_prime4;
+        }
+        if (end - p >= 4)
+        {
+            hash ^= detail::read_u32(p) * detail::xxh64_prime1;
+            hash = detail::rotl(hash, 23) * detail::xxh64_prime2 + detail::xxh64_prime3;
+            p += 4;
+        }
+        for (; p < end; ++p)
+        {
+            hash ^= static_cast<unsigned char>(*p) * detail::xxh64_prime5;
+            hash = detail::rotl(hash, 11) * detail::xxh64_prime1;
+        }
+
+        hash ^= hash >> 33;
+        hash *= detail::xxh64_prime2;
+        hash ^= hash >> 29;
+        hash *= detail::xxh64_prime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+#if SF_STRING_ID_LOOKUP
+    namespace detail
+    {
+        // Debug-only id -> name table. Names are copied so runtime strings may go away.
+        class string_id_registry
+        {
+        public:
+            static string_id_registry &instance()
+            {
+                static string_id_registry registry;
+                return registry;
+            }
+
+            void add(uint64_t id, std::string_view name)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                names_.try_emplace(id, name);
+            }
+
+            std::string_view find(uint64_t id) const
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                const auto it = names_.find(id);
+                return it != names_.end() ? std::string_view(it->second) : std::string_view();
+            }
+
+        private:
+            mutable std::mutex mutex_;
+            std::unordered_map<uint64_t, std::string> names_;
+        };
+    }
+#endif
+
+    /**
+     * @brief 64-bit id of a name (resource, event type, config key...), hashed at compile time when possible.
+     *
+     * Compares and hashes as a plain integer. In builds with SF_STRING_ID_LOOKUP, every id created
+     * from a literal or at runtime can be turned back into its name with name().
+     */
+    class string_id
+    {
+    public:
+        constexpr string_id() noexcept = default;
+
+        constexpr explicit string_id(std::string_view name) noexcept : value_(hash_xxh64(name))
+        {
+#if SF_STRING_ID_LOOKUP
+            if (!std::is_constant_evaluated())
+                detail::string_id_registry::instance().add(value_, name);
+#endif
+        }
+
+        static constexpr string_id from_value(uint64_t value) noexcept
+        {
+            string_id id;
+            id.value_ = value;
+            return id;
+        }
+
+        constexpr uint64_t value() const noexcept { return value_; }
+        constexpr explicit operator bool() const noexcept { return value_ != 0; }
+
+        constexpr bool operator==(const string_id &) const noexcept = default;
+        constexpr auto operator<=>(const string_id &) const noexcept = default;
+
+        /**
+         * @brief Name the id was created from, empty when unknown or when the lookup is compiled out.
+         */
+        std::string_view name() const
+        {
+#if SF_STRING_ID_LOOKUP
+            return detail::string_id_registry::instance().find(value_);
+#else
+            return {};
+#endif
+        }
+
+    private:
+        uint64_t value_ = 0;
+    };
+
+    namespace detail
+    {
+        template <std::size_t N>
+        struct fixed_string
+        {
+            char data[N]{};
+
+            constexpr fixed_string(const char (&str)[N]) noexcept
+            {
+                for (std::size_t i = 0; i < N; ++i)
+                    data[i] = str[i];
+            }
+
+            constexpr std::string_view view() const noexcept { return {data, N - 1}; }
+        };
+
+#if SF_STRING_ID_LOOKUP
+        // One instance per distinct literal; its initializer records the name at startup
+        template <fixed_string Name>
+        struct string_id_literal
+        {
+            static inline const bool registered = []
+            {
+                string_id_registry::instance().add(hash_xxh64(Name.view()), Name.view());
+                return true;
+            }();
+        };
+#endif
+    }
+
+    namespace literals
+    {
+        /**
+         * @brief "name"_id, a string_id computed at compile time.
+         */
+        template <detail::fixed_string Name>
+        consteval string_id operator""_id() noexcept
+        {
+#if SF_STRING_ID_LOOKUP
+            (void)&detail::string_id_literal<Name>::registered;
+#endif
+            return string_id::from_value(hash_xxh64(Name.view()));
+        }
+    }
+}
+
+template <>
+struct std::hash<SF::Engine::string_id>
+{
+    size_t operator()(const SF::Engine::string_id &id) const noexcept
+    {
+        return static_cast<size_t>(id.value());
+    }
+};
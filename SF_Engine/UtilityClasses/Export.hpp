@@ -1,5 +1,10 @@
-#ifdef SF_Engine_DLL
-#define SF_Export __declspec(dllexport)
+#pragma once
+
+// Marks the classes and functions SF_Engine exposes. Windows builds already export every symbol
+// (WINDOWS_EXPORT_ALL_SYMBOLS); elsewhere the library is built with hidden visibility, so what is
+// defined in a .cpp and called from outside needs default visibility.
+#if defined(_WIN32)
+#define SF_Export
 #else
-#define SF_Export __declspec(dllimport)
-#endif
\ No newline at end of file
+#define SF_Export __attribute__((visibility("default")))
+#endif
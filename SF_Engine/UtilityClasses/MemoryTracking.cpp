@@ -0,0 +1,250 @@
+/******************************************************************************/
+/* MemoryTracking.cpp                                                         */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "MemoryTracking.hpp"
+
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+namespace SF::Engine
+{
+    MemoryTracker &MemoryTracker::Get() noexcept
+    {
+        static constinit MemoryTracker tracker;
+        return tracker;
+    }
+
+    MemoryTag MemoryTracker::Register(std::string_view name, size_t budgetBytes)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        const size_t tag = tagCount.load(std::memory_order_relaxed);
+        if (tag >= MaxTags)
+            return UntaggedMemory;
+
+        tags[tag].name = name;
+        tags[tag].budgetBytes.store(budgetBytes, std::memory_order_relaxed);
+        tagCount.store(tag + 1, std::memory_order_release);
+        return static_cast<MemoryTag>(tag);
+    }
+
+    void MemoryTracker::SetBudget(MemoryTag tag, size_t budgetBytes) noexcept
+    {
+        tags[tag].budgetBytes.store(budgetBytes, std::memory_order_relaxed);
+        tags[tag].overBudget.store(false, std::memory_order_relaxed);
+    }
+
+    void MemoryTracker::OnBudgetExceeded(MemoryTag tag) noexcept
+    {
+        // Only flags it: this runs inside operator new, where logging could recurse
+        if (!tags[tag].overBudget.exchange(true, std::memory_order_relaxed))
+            assert(!assertOnBudget.load(std::memory_order_relaxed) && "Memory budget exceeded, see MemoryTracker::GetReport()");
+    }
+
+    void MemoryTracker::Sample()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch())
+                                .count();
+        const double seconds = lastSampleNanoseconds != 0 ? static_cast<double>(now - lastSampleNanoseconds) * 1e-9 : 0.0;
+        lastSampleNanoseconds = now;
+
+        const size_t count = tagCount.load(std::memory_order_acquire);
+        for (size_t tag = 0; tag < count; ++tag)
+        {
+            Counters &counters = tags[tag];
+            const uint64_t allocations = counters.allocationCount.load(std::memory_order_relaxed);
+            const uint64_t bytes = counters.allocatedBytes.load(std::memory_order_relaxed);
+
+            if (seconds > 0.0)
+            {
+                counters.allocationsPerSecond = static_cast<double>(allocations - counters.sampledAllocationCount) / seconds;
+                counters.bytesPerSecond = static_cast<double>(bytes - counters.sampledAllocatedBytes) / seconds;
+            }
+            counters.sampledAllocationCount = allocations;
+            counters.sampledAllocatedBytes = bytes;
+        }
+    }
+
+    std::vector<MemoryTag> MemoryTracker::TakeBudgetViolations()
+    {
+        std::vector<MemoryTag> violations;
+        const size_t count = tagCount.load(std::memory_order_acquire);
+        for (size_t tag = 0; tag < count; ++tag)
+        {
+            Counters &counters = tags[tag];
+            if (!counters.overBudget.load(std::memory_order_relaxed))
+                continue;
+
+            // Stays flagged while still over, so the next crossing is reported again once it drops back
+            if (counters.liveBytes.load(std::memory_order_relaxed) <= counters.budgetBytes.load(std::memory_order_relaxed))
+                counters.overBudget.store(false, std::memory_order_relaxed);
+            violations.push_back(static_cast<MemoryTag>(tag));
+        }
+        return violations;
+    }
+
+    MemoryTagStats MemoryTracker::GetStats(MemoryTag tag) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        const Counters &counters = tags[tag];
+        MemoryTagStats stats;
+        stats.name = tag == UntaggedMemory ? std::string_view("Untagged") : counters.name;
+        stats.tag = tag;
+        stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+        stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+        stats.budgetBytes = counters.budgetBytes.load(std::memory_order_relaxed);
+        stats.allocationCount = counters.allocationCount.load(std::memory_order_relaxed);
+        stats.allocatedBytes = counters.allocatedBytes.load(std::memory_order_relaxed);
+        stats.allocationsPerSecond = counters.allocationsPerSecond;
+        stats.bytesPerSecond = counters.bytesPerSecond;
+        return stats;
+    }
+
+    std::vector<MemoryTagStats> MemoryTracker::GetReport() const
+    {
+        std::vector<MemoryTagStats> report;
+        const size_t count = tagCount.load(std::memory_order_acquire);
+        report.reserve(count);
+        for (size_t tag = 0; tag < count; ++tag)
+            report.push_back(GetStats(static_cast<MemoryTag>(tag)));
+        return report;
+    }
+}
+
+#if SF_TRACK_MODULE_MEMORY
+#if defined(_WIN32)
+#error "SF_TRACK_MODULE_MEMORY replaces new/delete per DLL on Windows, which would free the executable's allocations as tracked ones"
+#endif
+
+// Global new/delete charging the current tag. Every block starts with a header holding the
+// tag, the size and the distance back to the start of the underlying allocation.
+namespace
+{
+    struct alignas(16) AllocationHeader
+    {
+        uint64_t size;
+        uint32_t tag;
+        uint32_t offset; // From the start of the underlying allocation to the user pointer
+    };
+    static_assert(sizeof(AllocationHeader) == 16);
+
+    void *TrackedAllocate(size_t size, size_t alignment) noexcept
+    {
+        const size_t offset = alignment > sizeof(AllocationHeader) ? alignment : sizeof(AllocationHeader);
+        if (size > SIZE_MAX - offset - alignment)
+            return nullptr;
+
+        void *base;
+        if (alignment <= alignof(std::max_align_t))
+        {
+            base = std::malloc(size + offset);
+        }
+        else
+        {
+            const size_t total = (size + offset + alignment - 1) & ~(alignment - 1);
+            base = std::aligned_alloc(alignment, total);
+        }
+        if (!base)
+            return nullptr;
+
+        auto *user = static_cast<std::byte *>(base) + offset;
+        const SF::Engine::MemoryTag tag = SF::Engine::GetCurrentMemoryTag();
+        new (user - sizeof(AllocationHeader)) AllocationHeader{size, tag, static_cast<uint32_t>(offset)};
+        SF::Engine::MemoryTracker::Get().RecordAllocation(tag, size);
+        return user;
+    }
+
+    void TrackedFree(void *ptr) noexcept
+    {
+        if (!ptr)
+            return;
+
+        auto *user = static_cast<std::byte *>(ptr);
+        const auto *header = reinterpret_cast<const AllocationHeader *>(user - sizeof(AllocationHeader));
+        SF::Engine::MemoryTracker::Get().RecordDeallocation(header->tag, header->size);
+
+        // aligned_alloc memory is released with free as well
+        std::free(user - header->offset);
+    }
+
+    void *TrackedNew(size_t size, size_t alignment)
+    {
+        while (true)
+        {
+            if (void *ptr = TrackedAllocate(size != 0 ? size : 1, alignment))
+                return ptr;
+
+            std::new_handler handler = std::get_new_handler();
+            if (!handler)
+                throw std::bad_alloc();
+            handler();
+        }
+    }
+}
+
+// Default visibility so the replacement also covers the executable and other libraries
+#if defined(__GNUC__) || defined(__clang__)
+#define SF_MEMORY_HOOK_EXPORT __attribute__((visibility("default")))
+#else
+#define SF_MEMORY_HOOK_EXPORT
+#endif
+
+SF_MEMORY_HOOK_EXPORT void *operator new(size_t size) { return TrackedNew(size, alignof(std::max_align_t)); }
+SF_MEMORY_HOOK_EXPORT void *operator new[](size_t size) { return TrackedNew(size, alignof(std::max_align_t)); }
+SF_MEMORY_HOOK_EXPORT void *operator new(size_t size, std::align_val_t alignment) { return TrackedNew(size, static_cast<size_t>(alignment)); }
+SF_MEMORY_HOOK_EXPORT void *operator new[](size_t size, std::align_val_t alignment) { return TrackedNew(size, static_cast<size_t>(alignment)); }
+
+SF_MEMORY_HOOK_EXPORT void *operator new(size_t size, const std::nothrow_t &) noexcept { return TrackedAllocate(size != 0 ? size : 1, alignof(std::max_align_t)); }
+SF_MEMORY_HOOK_EXPORT void *operator new[](size_t size, const std::nothrow_t &) noexcept { return TrackedAllocate(size != 0 ? size : 1, alignof(std::max_align_t)); }
+SF_MEMORY_HOOK_EXPORT void *operator new(size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept { return TrackedAllocate(size != 0 ? size : 1, static_cast<size_t>(alignment)); }
+SF_MEMORY_HOOK_EXPORT void *operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept { return TrackedAllocate(size != 0 ? size : 1, static_cast<size_t>(alignment)); }
+
+SF_MEMORY_HOOK_EXPORT void operator delete(void *ptr) noexcept { TrackedFree(ptr); }
+SF_MEMORY_HOOK_EXPORT void operator delete[](void *ptr) noexcept { TrackedFree(ptr); }
+SF_MEMORY_HOOK_EXPORT void operator delete(void *ptr, size_t) noexcept { TrackedFree(ptr); }
+SF_MEMORY_HOOK_EXPORT void operator delete[](void *ptr, size_t) noexcept { TrackedFree(ptr); }
+SF_MEMORY_HOOK_EXPORT void operator delete(void *ptr, std::align_val_t) noexcept { TrackedFree(ptr); }
+SF_MEMORY_HOOK_EXPORT void operator delete[](void *ptr, std::align_val_t) noexcept { TrackedFree(ptr); }
+SF_MEMORY_HOOK_EXPORT void operator delete(void *ptr, size_t, std::align_val_t) noexcept { TrackedFree(ptr); }
+SF_MEMORY_HOOK_EXPORT void operator delete[](void *ptr, size_t, std::align_val_t) noexcept { TrackedFree(ptr); }
+SF_MEMORY_HOOK_EXPORT void operator delete(void *ptr, const std::nothrow_t &) noexcept { TrackedFree(ptr); }
+SF_MEMORY_HOOK_EXPORT void operator delete[](void *ptr, const std::nothrow_t &) noexcept { TrackedFree(ptr); }
+SF_MEMORY_HOOK_EXPORT void operator delete(void *ptr, std::align_val_t, const std::nothrow_t &) noexcept { TrackedFree(ptr); }
+SF_MEMORY_HOOK_EXPORT void operator delete[](void *ptr, std::align_val_t, const std::nothrow_t &) noexcept { TrackedFree(ptr); }
+#endif
@@ -0,0 +1,249 @@
+/******************************************************************************/
+/* MemoryTracking.hpp                                                         */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "Export.hpp"
+
+// Memory attribution by tag. Each engine module gets a tag; while one of its functions runs, a
+// MemoryScope makes that tag current on the thread, and allocations are charged to it:
+//  - through TrackedResource, a std::pmr::memory_resource that charges a fixed tag, and
+//  - when SF_Engine is built with SF_TRACK_MODULE_MEMORY, through every global new/delete,
+//    which are then replaced to charge the current tag (a 16 byte header per allocation
+//    remembers the tag and size so the free is credited to the same tag). Not on Windows,
+//    where a replacement inside the engine DLL would not see the executable's allocations.
+// Counters are relaxed atomics, so any thread can allocate under any tag.
+namespace SF::Engine
+{
+    using MemoryTag = uint32_t;
+
+    /**
+     * @brief Tag of memory allocated outside of any MemoryScope.
+     */
+    inline constexpr MemoryTag UntaggedMemory = 0;
+
+    /**
+     * @brief Point-in-time counters of one tag.
+     */
+    struct MemoryTagStats
+    {
+        std::string_view name;
+        MemoryTag tag = UntaggedMemory;
+        size_t liveBytes = 0;          // Allocated and not yet freed
+        size_t peakBytes = 0;          // Highest liveBytes ever reached
+        size_t budgetBytes = 0;        // 0 when there is no budget
+        uint64_t allocationCount = 0;  // Total allocations
+        uint64_t allocatedBytes = 0;   // Total bytes ever allocated
+        double allocationsPerSecond = 0.0; // Over the last Sample() interval
+        double bytesPerSecond = 0.0;       // Over the last Sample() interval
+    };
+
+    /**
+     * @brief Process-wide per-tag allocation counters.
+     */
+    class SF_Export MemoryTracker
+    {
+    public:
+        static constexpr size_t MaxTags = 256;
+
+        static MemoryTracker &Get() noexcept;
+
+        /**
+         * @brief Creates a tag, UntaggedMemory once MaxTags are in use.
+         * @param name Reported name, must outlive the tracker (module names are static).
+         * @param budgetBytes Live bytes the tag may hold, 0 for no budget.
+         */
+        MemoryTag Register(std::string_view name, size_t budgetBytes = 0);
+
+        void SetBudget(MemoryTag tag, size_t budgetBytes) noexcept;
+
+        /**
+         * @brief Whether going over a budget trips an assert (debug builds); it is always reported.
+         */
+        void SetAssertOnBudget(bool enabled) noexcept { assertOnBudget.store(enabled, std::memory_order_relaxed); }
+
+        void RecordAllocation(MemoryTag tag, size_t bytes) noexcept
+        {
+            Counters &counters = tags[tag];
+            const size_t live = counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+            counters.allocationCount.fetch_add(1, std::memory_order_relaxed);
+            counters.allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+            size_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+            while (live > peak && !counters.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+            {
+            }
+
+            const size_t budget = counters.budgetBytes.load(std::memory_order_relaxed);
+            if (budget != 0 && live > budget)
+                OnBudgetExceeded(tag);
+        }
+
+        void RecordDeallocation(MemoryTag tag, size_t bytes) noexcept
+        {
+            tags[tag].liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Updates the per-second rates from the counters since the previous call.
+         * The engine calls this about once a second.
+         */
+        void Sample();
+
+        /**
+         * @brief Tags whose budget was exceeded since the previous call, each reported once.
+         */
+        std::vector<MemoryTag> TakeBudgetViolations();
+
+        MemoryTagStats GetStats(MemoryTag tag) const;
+
+        /**
+         * @brief Stats of every registered tag, UntaggedMemory first.
+         */
+        std::vector<MemoryTagStats> GetReport() const;
+
+        size_t GetTagCount() const noexcept { return tagCount.load(std::memory_order_acquire); }
+
+    private:
+        constexpr MemoryTracker() noexcept = default;
+
+        void OnBudgetExceeded(MemoryTag tag) noexcept;
+
+        struct alignas(64) Counters
+        {
+            std::atomic<size_t> liveBytes{0};
+            std::atomic<size_t> peakBytes{0};
+            std::atomic<size_t> budgetBytes{0};
+            std::atomic<uint64_t> allocationCount{0};
+            std::atomic<uint64_t> allocatedBytes{0};
+            std::atomic<bool> overBudget{false};
+            std::string_view name;
+
+            // Written by Sample() under the tracker mutex
+            uint64_t sampledAllocationCount = 0;
+            uint64_t sampledAllocatedBytes = 0;
+            double allocationsPerSecond = 0.0;
+            double bytesPerSecond = 0.0;
+        };
+
+        std::array<Counters, MaxTags> tags{};
+        std::atomic<size_t> tagCount{1};
+        std::atomic<bool> assertOnBudget{false};
+        int64_t lastSampleNanoseconds = 0;
+        mutable std::mutex mutex;
+    };
+
+    namespace detail
+    {
+        // Constant initialized, so allocations made before main are already attributed. Exported so
+        // the engine and its users share one tag per thread
+        SF_Export inline thread_local MemoryTag currentMemoryTag = UntaggedMemory;
+    }
+
+    /**
+     * @brief Tag charged by the calling thread's allocations.
+     */
+    inline MemoryTag GetCurrentMemoryTag() noexcept
+    {
+        return detail::currentMemoryTag;
+    }
+
+    /**
+     * @brief Makes tag current on this thread until the scope ends. Costs two thread-local stores,
+     * cheap enough to wrap every module update.
+     */
+    class MemoryScope
+    {
+    public:
+        explicit MemoryScope(MemoryTag tag) noexcept
+            : previous(detail::currentMemoryTag)
+        {
+            detail::currentMemoryTag = tag;
+        }
+
+        ~MemoryScope()
+        {
+            detail::currentMemoryTag = previous;
+        }
+
+        MemoryScope(const MemoryScope &) = delete;
+        MemoryScope &operator=(const MemoryScope &) = delete;
+
+    private:
+        MemoryTag previous;
+    };
+
+    /**
+     * @brief Charges everything allocated through it to one tag, then forwards to upstream.
+     */
+    class TrackedResource : public std::pmr::memory_resource
+    {
+    public:
+        explicit TrackedResource(MemoryTag tag, std::pmr::memory_resource *upstream = std::pmr::get_default_resource()) noexcept
+            : tag(tag), upstream(upstream)
+        {
+        }
+
+        MemoryTag GetTag() const noexcept { return tag; }
+        std::pmr::memory_resource *GetUpstream() const noexcept { return upstream; }
+
+    protected:
+        void *do_allocate(size_t bytes, size_t alignment) override
+        {
+            void *ptr = upstream->allocate(bytes, alignment);
+            MemoryTracker::Get().RecordAllocation(tag, bytes);
+            return ptr;
+        }
+
+        void do_deallocate(void *ptr, size_t bytes, size_t alignment) override
+        {
+            MemoryTracker::Get().RecordDeallocation(tag, bytes);
+            upstream->deallocate(ptr, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+    private:
+        MemoryTag tag;
+        std::pmr::memory_resource *upstream;
+    };
+}
@@ -0,0 +1,374 @@
+/******************************************************************************/
+/* NumberParse.hpp                                                            */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+// UtilityClasses/NumberParse.hpp - from_chars-style number parsing for text assets.
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include <TemplateLibrary/Dynamic.hpp>
+#include <TemplateLibrary/Simd.hpp>
+#include <UtilityClasses/Char.hpp>
+
+// Same contract as std::from_chars (ptr/ec result, no locale, no leading whitespace) with
+// two differences: a leading '+' is accepted and floats are always chars_format::general.
+// Digit runs are measured 16 bytes at a time with SSE2 and converted 8 digits at a time
+// with SWAR; floats that fit Clinger's exact fast path never reach std::from_chars.
+namespace SF::Engine
+{
+    namespace detail
+    {
+        inline constexpr bool swar_enabled = std::endian::native == std::endian::little;
+
+        inline uint64_t load_u64(const char *p) noexcept
+        {
+            uint64_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        // True when all 8 bytes are '0'..'9'
+        inline bool is_eight_digits(uint64_t chunk) noexcept
+        {
+            return ((chunk & 0xF0F0F0F0F0F0F0F0ull) |
+                    (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
+        }
+
+        // Converts 8 ASCII digits (first digit in the lowest byte) with three multiplies
+        inline uint32_t parse_eight_digits(uint64_t chunk) noexcept
+        {
+            chunk = ((chunk & 0x0F0F0F0F0F0F0F0Full) * 2561) >> 8;
+            chunk = ((chunk & 0x00FF00FF00FF00FFull) * 6553601) >> 16;
+            chunk = ((chunk & 0x0000FFFF0000FFFFull) * 42949672960001ull) >> 32;
+            return static_cast<uint32_t>(chunk);
+        }
+
+        // Length of the run of digits starting at p, looking at no more than last
+        inline std::size_t digit_run(const char *p, const char *last) noexcept
+        {
+            const char *start = p;
+#if defined(SFTL_SIMD_SSE2)
+            const __m128i zero = _mm_set1_epi8('0');
+            const __m128i nine = _mm_set1_epi8(9);
+            while (last - p >= 16)
+            {
+                const __m128i offset = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), zero);
+                const __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(offset, nine), offset);
+                const uint32_t nonDigits = ~static_cast<uint32_t>(_mm_movemask_epi8(isDigit)) & 0xFFFFu;
+                if (nonDigits)
+                    return static_cast<std::size_t>(p - start) + SFTL::Simd::FirstSet(nonDigits);
+                p += 16;
+            }
+#endif
+            if constexpr (swar_enabled)
+            {
+                while (last - p >= 8 && is_eight_digits(load_u64(p)))
+                    p += 8;
+            }
+            while (p < last && is_digit(*p))
+                ++p;
+            return static_cast<std::size_t>(p - start);
+        }
+
+        // Accumulates count digits (count <= 19 keeps uint64 from overflowing)
+        inline uint64_t accumulate_digits(uint64_t value, const char *p, std::size_t count) noexcept
+        {
+            if constexpr (swar_enabled)
+            {
+                for (; count >= 8; count -= 8, p += 8)
+                    value = value * 100000000u + parse_eight_digits(load_u64(p));
+            }
+            for (; count > 0; --count, ++p)
+                value = value * 10 + static_cast<uint64_t>(*p - '0');
+            return value;
+        }
+
+        inline const char *skip_zeros(const char *p, const char *last) noexcept
+        {
+            while (p < last && *p == '0')
+                ++p;
+            return p;
+        }
+
+        inline constexpr double exact_powers_of_ten[23] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                                           1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+        // Clinger's fast path: mantissa and 10^|exponent| are both exact doubles, so a single
+        // multiply or divide gives the correctly rounded result
+        inline bool exact_double(uint64_t mantissa, int64_t exponent, double &out) noexcept
+        {
+            if (mantissa > (uint64_t(1) << 53) || exponent < -22 || exponent > 22)
+                return false;
+
+            out = static_cast<double>(mantissa);
+            if (exponent < 0)
+                out /= exact_powers_of_ten[-exponent];
+            else
+                out *= exact_powers_of_ten[exponent];
+            return true;
+        }
+
+        // Rounding the double again is only wrong when it landed exactly halfway between two
+        // floats, which the 29 bits dropped by the conversion tell us
+        inline bool exact_float(uint64_t mantissa, int64_t exponent, float &out) noexcept
+        {
+            double wide;
+            if (!exact_double(mantissa, exponent, wide))
+                return false;
+
+            if ((std::bit_cast<uint64_t>(wide) & 0x1FFFFFFFull) == 0x10000000ull)
+                return false;
+
+            out = static_cast<float>(wide);
+            return true;
+        }
+
+        template <typename T>
+        std::from_chars_result parse_float_fallback(const char *first, const char *last, const char *digits, bool negative, T &value) noexcept
+        {
+            T parsed{};
+            const auto result = std::from_chars(digits, last, parsed, std::chars_format::general);
+            if (result.ec == std::errc::invalid_argument)
+                return {first, result.ec};
+
+            if (result.ec == std::errc())
+                value = negative ? -parsed : parsed;
+            return result;
+        }
+    }
+
+    /**
+     * @brief Parses a base 10 integer from [first, last).
+     */
+    template <typename T>
+        requires(std::is_integral_v<T> && !std::is_same_v<T, bool>)
+    std::from_chars_result parse_number(const char *first, const char *last, T &value) noexcept
+    {
+        const char *p = first;
+        bool negative = false;
+        if (p < last && (*p == '-' || *p == '+'))
+        {
+            negative = *p == '-';
+            if (negative && std::is_unsigned_v<T>)
+                return {first, std::errc::invalid_argument};
+            ++p;
+        }
+
+        const char *digits = detail::skip_zeros(p, last);
+        const std::size_t run = detail::digit_run(digits, last);
+        if (run == 0 && digits == p)
+            return {first, std::errc::invalid_argument};
+
+        const char *end = digits + run;
+        if (run > 20)
+            return {end, std::errc::result_out_of_range};
+
+        // 19 digits always fit, the 20th needs an overflow check
+        uint64_t magnitude = detail::accumulate_digits(0, digits, run < 19 ? run : 19);
+        if (run == 20)
+        {
+            const uint64_t lastDigit = static_cast<uint64_t>(digits[19] - '0');
+            if (magnitude > (std::numeric_limits<uint64_t>::max() - lastDigit) / 10)
+                return {end, std::errc::result_out_of_range};
+            magnitude = magnitude * 10 + lastDigit;
+        }
+
+        using U = std::make_unsigned_t<T>;
+        const uint64_t limit = negative ? uint64_t(U(std::numeric_limits<T>::max())) + 1 : uint64_t(U(std::numeric_limits<T>::max()));
+        if (magnitude > limit)
+            return {end, std::errc::result_out_of_range};
+
+        value = negative ? static_cast<T>(U(0) - static_cast<U>(magnitude)) : static_cast<T>(magnitude);
+        return {end, std::errc()};
+    }
+
+    /**
+     * @brief Parses a float or double ([sign] digits [. digits] [e [sign] digits], inf, nan) from [first, last).
+     */
+    template <typename T>
+        requires(std::is_same_v<T, float> || std::is_same_v<T, double>)
+    std::from_chars_result parse_number(const char *first, const char *last, T &value) noexcept
+    {
+        const char *p = first;
+        bool negative = false;
+        if (p < last && (*p == '-' || *p == '+'))
+        {
+            negative = *p == '-';
+            ++p;
+        }
+        const char *digitsStart = p;
+        if (p < last && (*p == '-' || *p == '+'))
+            return {first, std::errc::invalid_argument};
+
+        uint64_t mantissa = 0;
+        std::size_t significant = 0;
+        int64_t exponent = 0;
+        bool exact = true;
+
+        // Integer part
+        p = detail::skip_zeros(p, last);
+        bool anyDigits = p != digitsStart;
+        std::size_t run = detail::digit_run(p, last);
+        anyDigits |= run != 0;
+        if (run > 19)
+            exact = false;
+        else
+        {
+            mantissa = detail::accumulate_digits(0, p, run);
+            significant = run;
+        }
+        p += run;
+
+        // Fraction
+        if (p < last && *p == '.')
+        {
+            ++p;
+            if (significant == 0)
+            {
+                // Leading zeros of 0.000123 only move the exponent
+                const char *nonZero = detail::skip_zeros(p, last);
+                exponent -= nonZero - p;
+                anyDigits |= nonZero != p;
+                p = nonZero;
+            }
+
+            run = detail::digit_run(p, last);
+            anyDigits |= run != 0;
+            if (exact && significant + run <= 19)
+            {
+                mantissa = detail::accumulate_digits(mantissa, p, run);
+                significant += run;
+                exponent -= static_cast<int64_t>(run);
+            }
+            else
+            {
+                exact = false;
+            }
+            p += run;
+        }
+
+        if (!anyDigits)
+            return detail::parse_float_fallback(first, last, digitsStart, negative, value); // inf, nan or garbage
+
+        // Exponent, only consumed when digits follow
+        if (p < last && (*p == 'e' || *p == 'E'))
+        {
+            const char *e = p + 1;
+            bool negativeExponent = false;
+            if (e < last && (*e == '-' || *e == '+'))
+            {
+                negativeExponent = *e == '-';
+                ++e;
+            }
+
+            const std::size_t exponentRun = detail::digit_run(e, last);
+            if (exponentRun != 0)
+            {
+                if (exponentRun > 6)
+                    exact = false;
+                else
+                {
+                    const int64_t parsed = static_cast<int64_t>(detail::accumulate_digits(0, e, exponentRun));
+                    exponent += negativeExponent ? -parsed : parsed;
+                }
+                p = e + exponentRun;
+            }
+        }
+
+        T result;
+        bool converted;
+        if constexpr (std::is_same_v<T, float>)
+            converted = exact && detail::exact_float(mantissa, exponent, result);
+        else
+            converted = exact && detail::exact_double(mantissa, exponent, result);
+
+        if (converted || (exact && mantissa == 0))
+        {
+            if (!converted)
+                result = T(0);
+            value = negative ? -result : result;
+            return {p, std::errc()};
+        }
+
+        return detail::parse_float_fallback(first, last, digitsStart, negative, value);
+    }
+
+    template <typename T>
+    std::from_chars_result parse_number(std::string_view text, T &value) noexcept
+    {
+        return parse_number(text.data(), text.data() + text.size(), value);
+    }
+
+    /**
+     * @brief Parses a whitespace and/or comma separated list of numbers, appending them to out.
+     * @return ptr at the end of the text, or at the token that failed to parse with ec set.
+     */
+    template <typename T, typename Allocator>
+    std::from_chars_result parse_numbers(std::string_view text, SFTL::DynamicArray<T, Allocator> &out)
+    {
+        const char *p = text.data();
+        const char *last = text.data() + text.size();
+
+        while (true)
+        {
+            while (p < last && (is_space(*p) || *p == ','))
+                ++p;
+            if (p == last)
+                return {p, std::errc()};
+
+            T parsed{};
+            const auto result = parse_number(p, last, parsed);
+            if (result.ec != std::errc())
+                return {p, result.ec};
+
+            out.push_back(std::move(parsed));
+            p = result.ptr;
+        }
+    }
+
+    /**
+     * @brief parse_numbers for the common mesh/CSV case.
+     */
+    template <typename Allocator>
+    std::from_chars_result parse_floats(std::string_view text, SFTL::DynamicArray<float, Allocator> &out)
+    {
+        return parse_numbers(text, out);
+    }
+}
@@ -86,7 +86,8 @@ namespace SF::Engine
             }
 
         protected:
-            static bool Register(std::string_view name)
+            // Without a name the stream registers under its readable type name
+            static bool Register(std::string_view name = TypeName<T>())
             {
                 s_name = name;
 
@@ -40,12 +40,15 @@
 #include <queue>
 #include <future>
 
+#include "Export.hpp"
+#include "MemoryTracking.hpp"
+
 namespace SF::Engine
 {
     /**
      * @brief A fixed size pool of threads.
      */
-    class ThreadPool
+    class SF_Export ThreadPool
     {
     public:
         explicit ThreadPool(uint32_t threadCount = std::thread::hardware_concurrency());
@@ -81,8 +84,11 @@ namespace SF::Engine
             if (stop)
                 throw std::runtime_error("Enqueue called on a stopped ThreadPool");
 
-            tasks.emplace([task]()
-                          { (*task)(); });
+            // Tasks are charged to the memory tag of whoever queued them
+            tasks.emplace([task, tag = GetCurrentMemoryTag()]()
+                          {
+                              MemoryScope scope(tag);
+                              (*task)(); });
         }
 
         condition.notify_one();
@@ -34,19 +34,78 @@
 
 #pragma once
 
-#include <typeindex>
-#include <unordered_map>
+#include <atomic>
+#include <cstdint>
 #include <type_traits>
 #include <string_view>
-#include <shared_mutex>
+#include <mutex>
+
+#include <UtilityClasses/ConstantExpression.hpp>
 
 namespace SF::Engine
 {
     using TypeId = std::size_t;
 
+    namespace detail
+    {
+        template <typename T>
+        constexpr std::string_view RawTypeName() noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return __FUNCSIG__;
+#else
+            return __PRETTY_FUNCTION__;
+#endif
+        }
+
+        // The signature text around the type is the same for every T, measure it once with int
+        inline constexpr std::string_view TypeNameProbe = RawTypeName<int>();
+        inline constexpr std::size_t TypeNamePrefix = TypeNameProbe.find("int");
+        inline constexpr std::size_t TypeNameSuffix = TypeNameProbe.size() - TypeNamePrefix - 3;
+
+        // MSVC spells class types as "class Foo"/"struct Foo"
+        constexpr std::string_view StripTypeKeyword(std::string_view name) noexcept
+        {
+            for (std::string_view keyword : {std::string_view("class "), std::string_view("struct "), std::string_view("enum "), std::string_view("union ")})
+            {
+                if (name.starts_with(keyword))
+                    return name.substr(keyword.size());
+            }
+            return name;
+        }
+    }
+
+    /**
+     * @brief Readable name of T ("SF::Engine::Resources"), without RTTI.
+     *
+     * Spelling follows the compiler (e.g. "unsigned int" vs "unsigned"), so only compare
+     * names from the same build.
+     */
+    template <typename T>
+    [[nodiscard]] constexpr std::string_view TypeName() noexcept
+    {
+        constexpr std::string_view raw = detail::RawTypeName<T>();
+        return detail::StripTypeKeyword(raw.substr(detail::TypeNamePrefix, raw.size() - detail::TypeNamePrefix - detail::TypeNameSuffix));
+    }
+
+    /**
+     * @brief 64-bit hash of TypeName<T>(), stable across runs and across binaries built by the same compiler.
+     */
+    template <typename T>
+    [[nodiscard]] constexpr uint64_t TypeHash() noexcept
+    {
+        return hash_xxh64(TypeName<T>());
+    }
+
     /**
      * @brief Thread-safe type information system
      * @tparam T Base type for the type hierarchy
+     *
+     * IDs are dense (0, 1, 2... in order of first request) and cached in one atomic slot per
+     * type, so after the first call GetTypeId is two atomic loads. Each slot is tagged with the
+     * generation it was assigned in; Clear() starts a new generation, which invalidates every
+     * slot at once without having to know which types exist. cv-qualifiers are ignored, so
+     * const K and K share one slot.
      */
     template <typename T>
     class TypeInformation
@@ -56,34 +115,19 @@ namespace SF::Engine
 
         /**
          * @brief Get the type ID for a derived type K
-         * @tparam K The derived type (must be convertible to T*)
+         * @tparam K The derived type (must be convertible to T*, cv-qualifiers are ignored)
          * @return Unique type ID for K within the T hierarchy
          */
         template <typename K>
-            requires std::is_convertible_v<K *, T *>
+            requires std::is_convertible_v<std::remove_cv_t<K> *, T *>
         [[nodiscard]] static TypeId GetTypeId() noexcept
         {
-            // Use double-checked locking pattern for thread safety
-            const std::type_index typeIndex(typeid(K));
+            std::atomic<uint64_t> &slot = s_slot<std::remove_cv_t<K>>;
+            const uint64_t value = slot.load(std::memory_order_acquire);
+            if (SlotGeneration(value) == s_generation.load(std::memory_order_acquire))
+                return SlotId(value);
 
-            // First check without lock (read)
-            {
-                std::shared_lock lock(s_mutex);
-                if (auto it = s_typeMap.find(typeIndex); it != s_typeMap.end())
-                    return it->second;
-            }
-
-            // Not found, acquire write lock
-            std::unique_lock lock(s_mutex);
-
-            // Double-check after acquiring write lock
-            if (auto it = s_typeMap.find(typeIndex); it != s_typeMap.end())
-                return it->second;
-
-            // Create new ID
-            const auto id = s_nextTypeId++;
-            s_typeMap[typeIndex] = id;
-            return id;
+            return AssignTypeId(slot);
         }
 
         /**
@@ -92,10 +136,22 @@ namespace SF::Engine
          * @return Type name as string_view
          */
         template <typename K>
-            requires std::is_convertible_v<K *, T *>
+            requires std::is_convertible_v<std::remove_cv_t<K> *, T *>
         [[nodiscard]] static constexpr std::string_view GetTypeName() noexcept
         {
-            return typeid(K).name();
+            return TypeName<std::remove_cv_t<K>>();
+        }
+
+        /**
+         * @brief Get the stable hash for a derived type K
+         * @tparam K The derived type
+         * @return TypeHash of K without cv-qualifiers, unlike GetTypeId it does not depend on registration order
+         */
+        template <typename K>
+            requires std::is_convertible_v<std::remove_cv_t<K> *, T *>
+        [[nodiscard]] static constexpr uint64_t GetTypeHash() noexcept
+        {
+            return TypeHash<std::remove_cv_t<K>>();
         }
 
         /**
@@ -103,36 +159,60 @@ namespace SF::Engine
          */
         [[nodiscard]] static size_t GetRegisteredTypeCount() noexcept
         {
-            std::shared_lock lock(s_mutex);
-            return s_typeMap.size();
+            std::lock_guard lock(s_mutex);
+            return s_nextTypeId;
         }
 
         /**
          * @brief Check if a type is registered
          */
         template <typename K>
-            requires std::is_convertible_v<K *, T *>
+            requires std::is_convertible_v<std::remove_cv_t<K> *, T *>
         [[nodiscard]] static bool IsRegistered() noexcept
         {
-            std::shared_lock lock(s_mutex);
-            const std::type_index typeIndex(typeid(K));
-            return s_typeMap.find(typeIndex) != s_typeMap.end();
+            return SlotGeneration(s_slot<std::remove_cv_t<K>>.load(std::memory_order_acquire)) == s_generation.load(std::memory_order_acquire);
         }
 
         /**
          * @brief Clear all type registrations (use with caution!)
+         *
+         * IDs handed out before the call must not be used afterwards, and it must not race
+         * with GetTypeId on other threads.
          */
         static void Clear() noexcept
         {
-            std::unique_lock lock(s_mutex);
-            s_typeMap.clear();
+            std::lock_guard lock(s_mutex);
+            s_generation.fetch_add(1, std::memory_order_acq_rel);
             s_nextTypeId = 0;
         }
 
     private:
+        // Slot layout: generation in the high 32 bits, ID in the low 32 bits. Generation 0 is
+        // never current, so zero-initialized slots read as unassigned.
+        static constexpr uint32_t SlotGeneration(uint64_t slot) noexcept { return static_cast<uint32_t>(slot >> 32); }
+        static constexpr TypeId SlotId(uint64_t slot) noexcept { return static_cast<TypeId>(slot & 0xFFFFFFFFu); }
+
+        static TypeId AssignTypeId(std::atomic<uint64_t> &slot) noexcept
+        {
+            std::lock_guard lock(s_mutex);
+
+            // Another thread may have assigned it while we waited for the lock
+            const uint32_t generation = s_generation.load(std::memory_order_relaxed);
+            const uint64_t current = slot.load(std::memory_order_relaxed);
+            if (SlotGeneration(current) == generation)
+                return SlotId(current);
+
+            const TypeId id = s_nextTypeId++;
+            slot.store((static_cast<uint64_t>(generation) << 32) | static_cast<uint64_t>(id), std::memory_order_release);
+            return id;
+        }
+
+        template <typename K>
+        inline static std::atomic<uint64_t> s_slot{0};
+
+        inline static std::atomic<uint32_t> s_generation{1};
         inline static TypeId s_nextTypeId = 0;
-        inline static std::unordered_map<std::type_index, TypeId> s_typeMap = {};
-        inline static std::shared_mutex s_mutex;
+        inline static std::mutex s_mutex;
     };
 
     /**
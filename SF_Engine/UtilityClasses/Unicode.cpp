@@ -0,0 +1,592 @@
+/******************************************************************************/
+/* Unicode.cpp                                                                */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include "Unicode.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include <TemplateLibrary/Simd.hpp>
+
+// Validation follows Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction
+// Per Byte": three 16-entry nibble lookups classify every byte pair and a saturating
+// subtract checks the 3rd/4th byte positions. It needs pshufb (SSSE3). The transcoders
+// convert whole ASCII / BMP blocks with SSE2 and decode everything else one code point
+// at a time, validating as they go.
+namespace SF::Engine::Unicode
+{
+    namespace
+    {
+        inline bool IsContinuation(unsigned char byte) noexcept
+        {
+            return (byte & 0xC0) == 0x80;
+        }
+
+        inline bool IsSurrogate(char32_t codePoint) noexcept
+        {
+            return codePoint >= 0xD800 && codePoint <= 0xDFFF;
+        }
+
+        // Decodes the sequence at in, returns its length or 0 when it is invalid or truncated
+        inline size_t DecodeUtf8(const unsigned char *in, size_t remaining, char32_t &codePoint) noexcept
+        {
+            const unsigned char lead = in[0];
+            if (lead < 0x80)
+            {
+                codePoint = lead;
+                return 1;
+            }
+            if (lead < 0xC2)
+                return 0;
+
+            if (lead < 0xE0)
+            {
+                if (remaining < 2 || !IsContinuation(in[1]))
+                    return 0;
+                codePoint = (char32_t(lead & 0x1F) << 6) | (in[1] & 0x3F);
+                return 2;
+            }
+
+            if (lead < 0xF0)
+            {
+                if (remaining < 3 || !IsContinuation(in[1]) || !IsContinuation(in[2]))
+                    return 0;
+                codePoint = (char32_t(lead & 0x0F) << 12) | (char32_t(in[1] & 0x3F) << 6) | (in[2] & 0x3F);
+                return codePoint >= 0x800 && !IsSurrogate(codePoint) ? 3 : 0;
+            }
+
+            if (lead < 0xF5)
+            {
+                if (remaining < 4 || !IsContinuation(in[1]) || !IsContinuation(in[2]) || !IsContinuation(in[3]))
+                    return 0;
+                codePoint = (char32_t(lead & 0x07) << 18) | (char32_t(in[1] & 0x3F) << 12) |
+                            (char32_t(in[2] & 0x3F) << 6) | (in[3] & 0x3F);
+                return codePoint >= 0x10000 && codePoint <= 0x10FFFF ? 4 : 0;
+            }
+            return 0;
+        }
+
+        // Decodes the unit or surrogate pair at in, returns its length or 0 when unpaired
+        inline size_t DecodeUtf16(const char16_t *in, size_t remaining, char32_t &codePoint) noexcept
+        {
+            const char16_t unit = in[0];
+            if (unit < 0xD800 || unit > 0xDFFF)
+            {
+                codePoint = unit;
+                return 1;
+            }
+            if (unit > 0xDBFF || remaining < 2 || in[1] < 0xDC00 || in[1] > 0xDFFF)
+                return 0;
+
+            codePoint = 0x10000 + ((char32_t(unit) - 0xD800) << 10) + (char32_t(in[1]) - 0xDC00);
+            return 2;
+        }
+
+        inline size_t EncodeUtf8(char32_t codePoint, char *out) noexcept
+        {
+            if (codePoint < 0x80)
+            {
+                out[0] = static_cast<char>(codePoint);
+                return 1;
+            }
+            if (codePoint < 0x800)
+            {
+                out[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+                out[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                return 2;
+            }
+            if (codePoint < 0x10000)
+            {
+                out[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+                out[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                out[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                return 3;
+            }
+            out[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+            out[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            out[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+            return 4;
+        }
+
+        inline size_t EncodeUtf16(char32_t codePoint, char16_t *out) noexcept
+        {
+            if (codePoint < 0x10000)
+            {
+                out[0] = static_cast<char16_t>(codePoint);
+                return 1;
+            }
+            codePoint -= 0x10000;
+            out[0] = static_cast<char16_t>(0xD800 + (codePoint >> 10));
+            out[1] = static_cast<char16_t>(0xDC00 + (codePoint & 0x3FF));
+            return 2;
+        }
+
+        bool ValidateUtf8Scalar(const unsigned char *in, size_t size) noexcept
+        {
+            size_t i = 0;
+            while (i < size)
+            {
+                char32_t codePoint;
+                const size_t length = DecodeUtf8(in + i, size - i, codePoint);
+                if (length == 0)
+                    return false;
+                i += length;
+            }
+            return true;
+        }
+
+#if defined(SFTL_SIMD_SSE2)
+        // True when all 16 bytes are ASCII
+        inline bool IsAsciiBlock(__m128i block) noexcept
+        {
+            return _mm_movemask_epi8(block) == 0;
+        }
+#endif
+
+#if defined(SFTL_SIMD_SSSE3)
+        constexpr uint8_t TooShort = 1 << 0;
+        constexpr uint8_t TooLong = 1 << 1;
+        constexpr uint8_t Overlong3 = 1 << 2;
+        constexpr uint8_t TooLarge = 1 << 3;
+        constexpr uint8_t Surrogate = 1 << 4;
+        constexpr uint8_t Overlong2 = 1 << 5;
+        constexpr uint8_t TooLarge1000 = 1 << 6;
+        constexpr uint8_t Overlong4 = 1 << 6;
+        constexpr uint8_t TwoContinuations = 1 << 7;
+        constexpr uint8_t Carry = TooShort | TooLong | TwoContinuations;
+
+        inline __m128i Table(uint8_t a0, uint8_t a1, uint8_t a2, uint8_t a3, uint8_t a4, uint8_t a5, uint8_t a6, uint8_t a7,
+                             uint8_t a8, uint8_t a9, uint8_t a10, uint8_t a11, uint8_t a12, uint8_t a13, uint8_t a14, uint8_t a15) noexcept
+        {
+            return _mm_setr_epi8(char(a0), char(a1), char(a2), char(a3), char(a4), char(a5), char(a6), char(a7),
+                                 char(a8), char(a9), char(a10), char(a11), char(a12), char(a13), char(a14), char(a15));
+        }
+
+        inline __m128i HighNibbles(__m128i v) noexcept
+        {
+            return _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F));
+        }
+
+        // Errors of every (previous byte, byte) pair in the block, and of missing continuations
+        inline __m128i CheckBlock(__m128i input, __m128i previous) noexcept
+        {
+            const __m128i prev1 = _mm_alignr_epi8(input, previous, 15);
+
+            const __m128i byte1High = _mm_shuffle_epi8(
+                Table(TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+                      TwoContinuations, TwoContinuations, TwoContinuations, TwoContinuations,
+                      TooShort | Overlong2, TooShort, TooShort | Overlong3 | Surrogate,
+                      TooShort | TooLarge | TooLarge1000 | Overlong4),
+                HighNibbles(prev1));
+
+            const __m128i byte1Low = _mm_shuffle_epi8(
+                Table(Carry | Overlong3 | Overlong2 | Overlong4, Carry | Overlong2, Carry, Carry,
+                      Carry | TooLarge, Carry | TooLarge | TooLarge1000, Carry | TooLarge | TooLarge1000, Carry | TooLarge | TooLarge1000,
+                      Carry | TooLarge | TooLarge1000, Carry | TooLarge | TooLarge1000, Carry | TooLarge | TooLarge1000, Carry | TooLarge | TooLarge1000,
+                      Carry | TooLarge | TooLarge1000, Carry | TooLarge | TooLarge1000 | Surrogate, Carry | TooLarge | TooLarge1000, Carry | TooLarge | TooLarge1000),
+                _mm_and_si128(prev1, _mm_set1_epi8(0x0F)));
+
+            const __m128i byte2High = _mm_shuffle_epi8(
+                Table(TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+                      TooLong | Overlong2 | TwoContinuations | Overlong3 | TooLarge1000 | Overlong4,
+                      TooLong | Overlong2 | TwoContinuations | Overlong3 | TooLarge,
+                      TooLong | Overlong2 | TwoContinuations | Surrogate | TooLarge,
+                      TooLong | Overlong2 | TwoContinuations | Surrogate | TooLarge,
+                      TooShort, TooShort, TooShort, TooShort),
+                HighNibbles(input));
+
+            const __m128i special = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+
+            // Bytes 2 and 3 positions after a 3 or 4 byte lead must be continuations
+            const __m128i prev2 = _mm_alignr_epi8(input, previous, 14);
+            const __m128i prev3 = _mm_alignr_epi8(input, previous, 13);
+            const __m128i thirdByte = _mm_subs_epu8(prev2, _mm_set1_epi8(char(0xE0 - 0x80)));
+            const __m128i fourthByte = _mm_subs_epu8(prev3, _mm_set1_epi8(char(0xF0 - 0x80)));
+            const __m128i must23 = _mm_and_si128(_mm_or_si128(thirdByte, fourthByte), _mm_set1_epi8(char(0x80)));
+            return _mm_xor_si128(must23, special);
+        }
+
+        // Non-zero when the block ends inside a multi-byte sequence
+        inline __m128i IncompleteTail(__m128i input) noexcept
+        {
+            const __m128i limits = _mm_setr_epi8(char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF),
+                                                 char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF),
+                                                 char(0xF0 - 1), char(0xE0 - 1), char(0xC0 - 1));
+            return _mm_subs_epu8(input, limits);
+        }
+
+        bool ValidateUtf8Simd(const unsigned char *in, size_t size) noexcept
+        {
+            __m128i error = _mm_setzero_si128();
+            __m128i previous = _mm_setzero_si128();
+            __m128i incomplete = _mm_setzero_si128();
+
+            size_t i = 0;
+            for (; i + 16 <= size; i += 16)
+            {
+                const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+                if (IsAsciiBlock(input))
+                {
+                    // Only a sequence left open by the previous block can be wrong here
+                    error = _mm_or_si128(error, incomplete);
+                    incomplete = _mm_setzero_si128();
+                }
+                else
+                {
+                    error = _mm_or_si128(error, CheckBlock(input, previous));
+                    incomplete = IncompleteTail(input);
+                }
+                previous = input;
+            }
+
+            // Zero padding is ASCII, so the last block also catches sequences cut off by the end
+            alignas(16) unsigned char tail[16] = {};
+            std::memcpy(tail, in + i, size - i);
+            const __m128i input = _mm_load_si128(reinterpret_cast<const __m128i *>(tail));
+            error = _mm_or_si128(error, CheckBlock(input, previous));
+            error = _mm_or_si128(error, IncompleteTail(input));
+
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+        }
+#endif
+
+        // Runs of ASCII bytes are widened a block at a time, the rest is decoded one code point at a time
+        template <typename Unit, typename Emit>
+        TranscodeResult FromUtf8(const char *data, size_t size, Unit *out, Emit emit) noexcept
+        {
+            const auto *in = reinterpret_cast<const unsigned char *>(data);
+            size_t i = 0;
+            size_t written = 0;
+            while (i < size)
+            {
+#if defined(SFTL_SIMD_SSE2)
+                if (i + 16 <= size)
+                {
+                    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+                    if (IsAsciiBlock(block))
+                    {
+                        const __m128i zero = _mm_setzero_si128();
+                        const __m128i low = _mm_unpacklo_epi8(block, zero);
+                        const __m128i high = _mm_unpackhi_epi8(block, zero);
+                        if constexpr (sizeof(Unit) == 2)
+                        {
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written), low);
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written + 8), high);
+                        }
+                        else
+                        {
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written), _mm_unpacklo_epi16(low, zero));
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written + 4), _mm_unpackhi_epi16(low, zero));
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written + 8), _mm_unpacklo_epi16(high, zero));
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written + 12), _mm_unpackhi_epi16(high, zero));
+                        }
+                        i += 16;
+                        written += 16;
+                        continue;
+                    }
+                }
+#endif
+                if (in[i] < 0x80)
+                {
+                    out[written++] = static_cast<Unit>(in[i++]);
+                    continue;
+                }
+
+                char32_t codePoint;
+                const size_t length = DecodeUtf8(in + i, size - i, codePoint);
+                if (length == 0)
+                    return {i, written, false};
+                written += emit(codePoint, out + written);
+                i += length;
+            }
+            return {i, written, true};
+        }
+
+        template <typename Unit, typename Emit>
+        TranscodeResult FromUtf16(const char16_t *data, size_t size, Unit *out, Emit emit) noexcept
+        {
+            size_t i = 0;
+            size_t written = 0;
+            while (i < size)
+            {
+#if defined(SFTL_SIMD_SSE2)
+                if (i + 8 <= size)
+                {
+                    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+                    if constexpr (sizeof(Unit) == 1)
+                    {
+                        // 8 units below 0x80 narrow to 8 ASCII bytes
+                        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, _mm_set1_epi16(short(0xFF80))), _mm_setzero_si128())) == 0xFFFF)
+                        {
+                            _mm_storel_epi64(reinterpret_cast<__m128i *>(out + written), _mm_packus_epi16(block, block));
+                            i += 8;
+                            written += 8;
+                            continue;
+                        }
+                    }
+                    else
+                    {
+                        // 8 units outside the surrogate range widen to 8 code points
+                        const __m128i surrogates = _mm_cmpeq_epi16(_mm_and_si128(block, _mm_set1_epi16(short(0xF800))), _mm_set1_epi16(short(0xD800)));
+                        if (_mm_movemask_epi8(surrogates) == 0)
+                        {
+                            const __m128i zero = _mm_setzero_si128();
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written), _mm_unpacklo_epi16(block, zero));
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written + 4), _mm_unpackhi_epi16(block, zero));
+                            i += 8;
+                            written += 8;
+                            continue;
+                        }
+                    }
+                }
+#endif
+                char32_t codePoint;
+                const size_t length = DecodeUtf16(data + i, size - i, codePoint);
+                if (length == 0)
+                    return {i, written, false};
+                written += emit(codePoint, out + written);
+                i += length;
+            }
+            return {i, written, true};
+        }
+
+        template <typename Unit, typename Emit>
+        TranscodeResult FromUtf32(const char32_t *data, size_t size, Unit *out, Emit emit) noexcept
+        {
+            size_t i = 0;
+            size_t written = 0;
+            while (i < size)
+            {
+#if defined(SFTL_SIMD_SSE2)
+                if (i + 8 <= size)
+                {
+                    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+                    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i + 4));
+                    // Values are unsigned, every one below the limit means no sign bit and cmpgt is enough
+                    const __m128i limit = _mm_set1_epi32(sizeof(Unit) == 1 ? 0x80 : 0xD800);
+                    const __m128i below = _mm_and_si128(_mm_cmpgt_epi32(limit, a), _mm_cmpgt_epi32(limit, b));
+                    const __m128i positive = _mm_and_si128(_mm_cmpgt_epi32(a, _mm_set1_epi32(-1)), _mm_cmpgt_epi32(b, _mm_set1_epi32(-1)));
+                    if (_mm_movemask_epi8(_mm_and_si128(below, positive)) == 0xFFFF)
+                    {
+                        // Bias into the signed 16-bit range so the saturating pack is exact
+                        const __m128i bias32 = _mm_set1_epi32(0x8000);
+                        const __m128i packed = _mm_add_epi16(_mm_packs_epi32(_mm_sub_epi32(a, bias32), _mm_sub_epi32(b, bias32)), _mm_set1_epi16(short(0x8000)));
+                        if constexpr (sizeof(Unit) == 1)
+                            _mm_storel_epi64(reinterpret_cast<__m128i *>(out + written), _mm_packus_epi16(packed, packed));
+                        else
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written), packed);
+                        i += 8;
+                        written += 8;
+                        continue;
+                    }
+                }
+#endif
+                const char32_t codePoint = data[i];
+                if (codePoint > 0x10FFFF || IsSurrogate(codePoint))
+                    return {i, written, false};
+                written += emit(codePoint, out + written);
+                ++i;
+            }
+            return {i, written, true};
+        }
+
+        template <typename String, typename Convert>
+        std::optional<String> ConvertString(size_t capacity, Convert convert)
+        {
+            String result;
+            result.resize(capacity);
+            const TranscodeResult converted = convert(result.data());
+            if (!converted.valid)
+                return std::nullopt;
+
+            result.resize(converted.written);
+            return result;
+        }
+    }
+
+    bool ValidateUtf8(const char *data, size_t size) noexcept
+    {
+        const auto *in = reinterpret_cast<const unsigned char *>(data);
+#if defined(SFTL_SIMD_SSSE3)
+        return ValidateUtf8Simd(in, size);
+#else
+        size_t i = 0;
+#if defined(SFTL_SIMD_SSE2)
+        // ASCII fast path, then the scalar decoder for the rest
+        for (; i + 16 <= size; i += 16)
+        {
+            if (!IsAsciiBlock(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i))))
+                break;
+        }
+#endif
+        return ValidateUtf8Scalar(in + i, size - i);
+#endif
+    }
+
+    bool ValidateUtf16(const char16_t *data, size_t size) noexcept
+    {
+        size_t i = 0;
+        while (i < size)
+        {
+            char32_t codePoint;
+            const size_t length = DecodeUtf16(data + i, size - i, codePoint);
+            if (length == 0)
+                return false;
+            i += length;
+        }
+        return true;
+    }
+
+    size_t Utf16LengthFromUtf8(const char *data, size_t size) noexcept
+    {
+        // One unit per lead byte, two for 4 byte leads
+        size_t length = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            const auto byte = static_cast<unsigned char>(data[i]);
+            length += (byte & 0xC0) != 0x80;
+            length += byte >= 0xF0;
+        }
+        return length;
+    }
+
+    size_t Utf32LengthFromUtf8(const char *data, size_t size) noexcept
+    {
+        size_t length = 0;
+        for (size_t i = 0; i < size; ++i)
+            length += (static_cast<unsigned char>(data[i]) & 0xC0) != 0x80;
+        return length;
+    }
+
+    size_t Utf8LengthFromUtf16(const char16_t *data, size_t size) noexcept
+    {
+        // A surrogate pair is 4 bytes, 2 per unit
+        size_t length = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            const char16_t unit = data[i];
+            length += 1 + (unit >= 0x80) + (unit >= 0x800 && (unit < 0xD800 || unit > 0xDFFF));
+        }
+        return length;
+    }
+
+    size_t Utf8LengthFromUtf32(const char32_t *data, size_t size) noexcept
+    {
+        size_t length = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            const char32_t codePoint = data[i];
+            length += 1 + (codePoint >= 0x80) + (codePoint >= 0x800) + (codePoint >= 0x10000);
+        }
+        return length;
+    }
+
+    TranscodeResult Utf8ToUtf16(const char *data, size_t size, char16_t *out) noexcept
+    {
+        return FromUtf8(data, size, out, EncodeUtf16);
+    }
+
+    TranscodeResult Utf8ToUtf32(const char *data, size_t size, char32_t *out) noexcept
+    {
+        return FromUtf8(data, size, out, [](char32_t codePoint, char32_t *unit) noexcept -> size_t
+                        {
+                            *unit = codePoint;
+                            return 1; });
+    }
+
+    TranscodeResult Utf16ToUtf8(const char16_t *data, size_t size, char *out) noexcept
+    {
+        return FromUtf16(data, size, out, EncodeUtf8);
+    }
+
+    TranscodeResult Utf16ToUtf32(const char16_t *data, size_t size, char32_t *out) noexcept
+    {
+        return FromUtf16(data, size, out, [](char32_t codePoint, char32_t *unit) noexcept -> size_t
+                         {
+                             *unit = codePoint;
+                             return 1; });
+    }
+
+    TranscodeResult Utf32ToUtf8(const char32_t *data, size_t size, char *out) noexcept
+    {
+        return FromUtf32(data, size, out, EncodeUtf8);
+    }
+
+    TranscodeResult Utf32ToUtf16(const char32_t *data, size_t size, char16_t *out) noexcept
+    {
+        return FromUtf32(data, size, out, EncodeUtf16);
+    }
+
+    std::optional<std::u16string> ToUtf16(std::string_view text)
+    {
+        return ConvertString<std::u16string>(text.size(), [&](char16_t *out)
+                                             { return Utf8ToUtf16(text.data(), text.size(), out); });
+    }
+
+    std::optional<std::u32string> ToUtf32(std::string_view text)
+    {
+        return ConvertString<std::u32string>(text.size(), [&](char32_t *out)
+                                             { return Utf8ToUtf32(text.data(), text.size(), out); });
+    }
+
+    std::optional<std::wstring> ToWide(std::string_view text)
+    {
+        return ConvertString<std::wstring>(text.size(), [&](wchar_t *out)
+                                           {
+                                               if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+                                                   return Utf8ToUtf16(text.data(), text.size(), reinterpret_cast<char16_t *>(out));
+                                               else
+                                                   return Utf8ToUtf32(text.data(), text.size(), reinterpret_cast<char32_t *>(out)); });
+    }
+
+    std::optional<std::string> ToUtf8(std::u16string_view text)
+    {
+        return ConvertString<std::string>(text.size() * 3, [&](char *out)
+                                          { return Utf16ToUtf8(text.data(), text.size(), out); });
+    }
+
+    std::optional<std::string> ToUtf8(std::u32string_view text)
+    {
+        return ConvertString<std::string>(text.size() * 4, [&](char *out)
+                                          { return Utf32ToUtf8(text.data(), text.size(), out); });
+    }
+
+    std::optional<std::string> ToUtf8(std::wstring_view text)
+    {
+        if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+            return ToUtf8(std::u16string_view(reinterpret_cast<const char16_t *>(text.data()), text.size()));
+        else
+            return ToUtf8(std::u32string_view(reinterpret_cast<const char32_t *>(text.data()), text.size()));
+    }
+}
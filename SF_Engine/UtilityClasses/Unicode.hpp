@@ -0,0 +1,129 @@
+/******************************************************************************/
+/* Unicode.hpp                                                                */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "Export.hpp"
+
+namespace SF::Engine::Unicode
+{
+    /**
+     * @brief Outcome of a transcoding call.
+     *
+     * On invalid input read is the offset of the first code unit of the offending sequence,
+     * and written counts what was output before it.
+     */
+    struct TranscodeResult
+    {
+        size_t read = 0;
+        size_t written = 0;
+        bool valid = true;
+    };
+
+    /**
+     * @brief Checks that data is well-formed UTF-8 (no overlongs, surrogates or code points past U+10FFFF).
+     */
+    SF_Export bool ValidateUtf8(const char *data, size_t size) noexcept;
+
+    inline bool ValidateUtf8(std::string_view text) noexcept { return ValidateUtf8(text.data(), text.size()); }
+
+    /**
+     * @brief Checks that data has no unpaired surrogates.
+     */
+    SF_Export bool ValidateUtf16(const char16_t *data, size_t size) noexcept;
+
+    /**
+     * @brief Number of UTF-16 code units needed for valid UTF-8 input.
+     */
+    SF_Export size_t Utf16LengthFromUtf8(const char *data, size_t size) noexcept;
+
+    /**
+     * @brief Number of code points in valid UTF-8 input.
+     */
+    SF_Export size_t Utf32LengthFromUtf8(const char *data, size_t size) noexcept;
+
+    /**
+     * @brief Number of UTF-8 bytes needed for valid UTF-16 input.
+     */
+    SF_Export size_t Utf8LengthFromUtf16(const char16_t *data, size_t size) noexcept;
+
+    /**
+     * @brief Number of UTF-8 bytes needed for valid UTF-32 input.
+     */
+    SF_Export size_t Utf8LengthFromUtf32(const char32_t *data, size_t size) noexcept;
+
+    // The transcoders validate as they go and stop at the first invalid sequence. out must hold
+    // the worst case: size units for UTF-8 to UTF-16/32 and UTF-16 to UTF-32, 3 * size bytes for
+    // UTF-16 to UTF-8, 4 * size bytes for UTF-32 to UTF-8 and 2 * size units for UTF-32 to UTF-16.
+    SF_Export TranscodeResult Utf8ToUtf16(const char *data, size_t size, char16_t *out) noexcept;
+    SF_Export TranscodeResult Utf8ToUtf32(const char *data, size_t size, char32_t *out) noexcept;
+    SF_Export TranscodeResult Utf16ToUtf8(const char16_t *data, size_t size, char *out) noexcept;
+    SF_Export TranscodeResult Utf16ToUtf32(const char16_t *data, size_t size, char32_t *out) noexcept;
+    SF_Export TranscodeResult Utf32ToUtf8(const char32_t *data, size_t size, char *out) noexcept;
+    SF_Export TranscodeResult Utf32ToUtf16(const char32_t *data, size_t size, char16_t *out) noexcept;
+
+    /**
+     * @brief Converts UTF-8 to UTF-16, empty when text is not valid UTF-8.
+     */
+    SF_Export std::optional<std::u16string> ToUtf16(std::string_view text);
+
+    /**
+     * @brief Converts UTF-8 to UTF-32, empty when text is not valid UTF-8.
+     */
+    SF_Export std::optional<std::u32string> ToUtf32(std::string_view text);
+
+    /**
+     * @brief Converts UTF-8 to the platform wide encoding (UTF-16 on Windows, UTF-32 elsewhere).
+     */
+    SF_Export std::optional<std::wstring> ToWide(std::string_view text);
+
+    /**
+     * @brief Converts UTF-16 to UTF-8, empty on unpaired surrogates.
+     */
+    SF_Export std::optional<std::string> ToUtf8(std::u16string_view text);
+
+    /**
+     * @brief Converts UTF-32 to UTF-8, empty on surrogates or values past U+10FFFF.
+     */
+    SF_Export std::optional<std::string> ToUtf8(std::u32string_view text);
+
+    /**
+     * @brief Converts a platform wide string to UTF-8.
+     */
+    SF_Export std::optional<std::string> ToUtf8(std::wstring_view text);
+}
@@ -0,0 +1,83 @@
+/******************************************************************************/
+/* TestStringBuilder.cpp                                                      */
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                                SF Game Engine                              */
+/******************************************************************************/
+/* MIT License                                                                */
+/*                                                                            */
+/* Copyright (c) 2025-present Monsieur Martin.                                */
+/*                                                                            */
+/* May all those that this source may reach be blessed by the LORD and find   */
+/* peace and joy in life.                                                     */
+/* Everyone who drinks of this water will be thirsty again; but whoever       */
+/* drinks of the water that I will give him shall never thirst; John 4:13-14  */
+/*                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a    */
+/* copy of this software and associated documentation files (the "Software"), */
+/* to deal in the Software without restriction, including without limitation  */
+/* the rights to use, copy, modify, merge, publish, distribute, sublicense,   */
+/* and/or sell copies of the Software, and to permit persons to whom the      */
+/* Software is furnished to do so, subject to the following conditions:       */
+/*                                                                            */
+/* The above copyright notice and this permission notice shall be included in */
+/* all copies or substantial portions of the Software.                        */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS    */
+/* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF                 */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.     */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY       */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT  */
+/* OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE      */
+/* OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                              */
+/******************************************************************************/
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+#include <TemplateLibrary/Format.hpp>
+
+// Regression checks for SFTL::StringBuilder, returns non-zero on failure
+namespace
+{
+    int failures = 0;
+
+    void Check(bool condition, const char *what)
+    {
+        if (!condition)
+        {
+            std::printf("FAILED: %s\n", what);
+            ++failures;
+        }
+    }
+
+    // Appending the builder's own contents must survive the buffer growing underneath the view
+    void AppendSelf(size_t initialLength)
+    {
+        const std::string initial(initialLength, 'a');
+        SFTL::StringBuilder builder;
+        builder.Append(initial);
+
+        std::string expected = initial;
+        for (int i = 0; i < 4; ++i)
+        {
+            builder.Append(builder.View());
+            expected += expected;
+        }
+        Check(builder.View() == expected, "append the whole builder to itself");
+
+        builder.Append(builder.View().substr(1, 100));
+        expected += expected.substr(1, 100);
+        Check(builder.View() == expected, "append a slice of the builder to itself");
+    }
+}
+
+int main()
+{
+    AppendSelf(200); // Starts inline, grows onto the heap
+    AppendSelf(300); // Starts on the heap, grows again
+
+    if (failures == 0)
+        std::printf("All StringBuilder checks passed\n");
+    return failures == 0 ? 0 : 1;
+}